@@ -3857,6 +3857,21 @@ function djui_hud_reset_color()
     -- ...
 end
 
+--- @param r integer
+--- @param g integer
+--- @param b integer
+--- @param a integer
+--- @param size number
+--- Sets the outline drawn around DJUI HUD text, in the same pass as the text. The `size` is in HUD units at a text scale of 1, a size of 0 disables the outline
+function djui_hud_set_text_outline(r, g, b, a, size)
+    -- ...
+end
+
+--- Disables the outline drawn around DJUI HUD text
+function djui_hud_reset_text_outline()
+    -- ...
+end
+
 --- @return HudUtilsRotation
 --- Gets the current DJUI HUD rotation
 function djui_hud_get_rotation()
@@ -4807,7 +4822,7 @@ end
 
 --- @param otherNp NetworkPlayer
 --- @return MarioState
---- Gets the local Mario's state stored in lag compensation history
+--- Gets the local Mario's state stored in lag compensation history. Only the position, velocity, angles, action, timers, flags, hitbox and torso position are historical, every other field comes from the live state
 function lag_compensation_get_local_state(otherNp)
     -- ...
 end
@@ -13,7 +13,7 @@ void *dynos_swap_cmd(void *cmd);
 // -- built in -- //
 void *dynos_update_cmd(void *cmd);
 void  dynos_update_gfx();
-s32   dynos_tex_import(void **output, void *ptr, s32 tile, void *grapi, void **hashmap, void *pool, s32 *poolpos, s32 poolsize);
+s32   dynos_tex_import(void **output, void *ptr, s32 tile, void *grapi);
 void  dynos_gfx_swap_animations(void *ptr);
 
 // -- warps -- //
@@ -31,6 +31,7 @@ int dynos_pack_get_count(void);
 const char* dynos_pack_get_name(s32 index);
 bool dynos_pack_get_enabled(s32 index);
 void dynos_pack_set_enabled(s32 index, bool value);
+void dynos_pack_shutdown(void);
 bool dynos_pack_get_exists(s32 index);
 void dynos_generate_packs(const char* directory);
 
@@ -126,6 +126,16 @@ public:
         return _BinFile;
     }
 
+    // Takes ownership of aBuffer, which must have been allocated with malloc/calloc
+    static BinFile *OpenTake(u8 *aBuffer, s32 aSize) {
+        BinFile *_BinFile = (BinFile *) calloc(1, sizeof(BinFile));
+        _BinFile->mReadOnly = true;
+        _BinFile->mData = aBuffer;
+        _BinFile->mSize = aSize;
+        _BinFile->mCapacity = aSize;
+        return _BinFile;
+    }
+
     static void Close(BinFile *&aBinFile) {
         if (aBinFile) {
             if (!aBinFile->mReadOnly && aBinFile->mFilename && aBinFile->mData && aBinFile->mSize) {
@@ -595,6 +605,7 @@ struct PackData {
     Array<Pair<const char *, GfxData *>> mGfxData;
     Array<DataNode<TexData>*> mTextures;
     bool mLoaded;
+    bool mLoading;
 };
 
 typedef Pair<String, const u8 *> Label;
@@ -875,6 +886,8 @@ const char *     DynOS_Builtin_Gfx_GetFromData(const Gfx *aData);
 
 s32 DynOS_Pack_GetCount();
 void DynOS_Pack_SetEnabled(PackData* aPack, bool aEnabled);
+void DynOS_Pack_Update();
+void DynOS_Pack_Shutdown();
 PackData* DynOS_Pack_GetFromIndex(s32 aIndex);
 PackData* DynOS_Pack_GetFromPath(const SysPath& aPath);
 PackData* DynOS_Pack_Add(const SysPath& aPath);
@@ -912,7 +925,7 @@ void DynOS_Tex_Valid(GfxData* aGfxData);
 void DynOS_Tex_Invalid(GfxData* aGfxData);
 void DynOS_Tex_Update();
 u8 *DynOS_Tex_ConvertToRGBA32(const u8 *aData, u64 aLength, s32 aFormat, s32 aSize, const u8 *aPalette);
-bool DynOS_Tex_Import(void **aOutput, void *aPtr, s32 aTile, void *aGfxRApi, void **aHashMap, void *aPool, u32 *aPoolPos, u32 aPoolSize);
+bool DynOS_Tex_Import(void **aOutput, void *aPtr, s32 aTile, void *aGfxRApi);
 void DynOS_Tex_Activate(DataNode<TexData>* aNode, bool aCustomTexture);
 void DynOS_Tex_Deactivate(DataNode<TexData>* aNode);
 void DynOS_Tex_AddCustom(const SysPath &aFilename, const char *aTexName);
@@ -1075,6 +1088,7 @@ DataNode<u8>* DynOS_Rooms_Load(BinFile *aFile, GfxData *aGfxData);
 DataNode<TexData>* DynOS_Tex_Parse(GfxData* aGfxData, DataNode<TexData>* aNode);
 void DynOS_Tex_Write(BinFile* aFile, GfxData* aGfxData, DataNode<TexData> *aNode);
 DataNode<TexData>* DynOS_Tex_Load(BinFile *aFile, GfxData *aGfxData);
+DataNode<TexData>* DynOS_Tex_ReadBinary(const SysPath &aFilename);
 DataNode<TexData>* DynOS_Tex_LoadFromBinary(const SysPath &aPackFolder, const SysPath &aFilename, const char *aTexName, bool aAddToPack);
 void DynOS_Tex_ConvertTextureDataToPng(GfxData *aGfxData, TexData* aTexture);
 void DynOS_Tex_GeneratePack(const SysPath &aPackFolder, SysPath &aOutputFolder, bool aAllowCustomTextures);
@@ -1093,6 +1107,7 @@ void *DynOS_Pointer_Load(BinFile *aFile, GfxData *aGfxData, u32 aValue, u8* outF
 
 void DynOS_GfxDynCmd_Load(BinFile *aFile, GfxData *aGfxData);
 
+GfxData *DynOS_Actor_ReadBinary(const SysPath &aFilename);
 GfxData *DynOS_Actor_LoadFromBinary(const SysPath &aPackFolder, const char *aActorName, const SysPath &aFilename, bool aAddToPack);
 void DynOS_Actor_GeneratePack(const SysPath &aPackFolder);
 
@@ -77,19 +77,7 @@ static bool DynOS_Actor_WriteBinary(const SysPath &aOutputFilename, GfxData *aGf
  // Reading //
 /////////////
 
-GfxData *DynOS_Actor_LoadFromBinary(const SysPath &aPackFolder, const char *aActorName, const SysPath &aFilename, bool aAddToPack) {
-    // Look for pack in cache
-    PackData* _Pack = DynOS_Pack_GetFromPath(aPackFolder);
-
-    // Look for actor in pack
-    if (_Pack) {
-        auto _ActorPair = DynOS_Pack_GetActor(_Pack, aActorName);
-        if (_ActorPair != NULL) {
-            return _ActorPair->second;
-        }
-    }
-
-    // Load data from binary file
+GfxData *DynOS_Actor_ReadBinary(const SysPath &aFilename) {
     GfxData *_GfxData = NULL;
     BinFile *_File = DynOS_Bin_Decompress(aFilename);
     if (_File) {
@@ -113,6 +101,23 @@ GfxData *DynOS_Actor_LoadFromBinary(const SysPath &aPackFolder, const char *aAct
         }
         BinFile::Close(_File);
     }
+    return _GfxData;
+}
+
+GfxData *DynOS_Actor_LoadFromBinary(const SysPath &aPackFolder, const char *aActorName, const SysPath &aFilename, bool aAddToPack) {
+    // Look for pack in cache
+    PackData* _Pack = DynOS_Pack_GetFromPath(aPackFolder);
+
+    // Look for actor in pack
+    if (_Pack) {
+        auto _ActorPair = DynOS_Pack_GetActor(_Pack, aActorName);
+        if (_ActorPair != NULL) {
+            return _ActorPair->second;
+        }
+    }
+
+    // Load data from binary file
+    GfxData *_GfxData = DynOS_Actor_ReadBinary(aFilename);
 
     // Add data to cache, even if not loaded
     if (aAddToPack) {
@@ -2,11 +2,13 @@
 #include <zlib.h>
 
 static const u64 DYNOS_BIN_COMPRESS_MAGIC = 0x4E4942534F4E5944llu;
-static FILE  *sFile = NULL;
-static u8 *sBufferUncompressed = NULL;
-static u8 *sBufferCompressed = NULL;
-static u64 sLengthUncompressed = 0;
-static u64 sLengthCompressed = 0;
+static const u32 DYNOS_BIN_DECOMPRESS_CHUNK_SIZE = 0x10000;
+// Per-thread state, as pack bins can be decompressed on loader threads
+static thread_local FILE *sFile = NULL;
+static thread_local u8 *sBufferUncompressed = NULL;
+static thread_local u8 *sBufferCompressed = NULL;
+static thread_local u64 sLengthUncompressed = 0;
+static thread_local u64 sLengthCompressed = 0;
 
 static inline void DynOS_Bin_Compress_Init() {
     sFile = NULL;
@@ -184,52 +186,51 @@ BinFile *DynOS_Bin_Decompress(const SysPath &aFilename) {
         __FUNCTION__, aFilename.c_str(), "Cannot read uncompressed file size"
     )) return NULL;
 
-    // Retrieve file length
-    if (!DynOS_Bin_Compress_Check(
-        f_seek(sFile, 0, SEEK_END) == 0,
-        __FUNCTION__, aFilename.c_str(), "Cannot retrieve file length"
-    )) return NULL;
-
-    // Check file length
-    u64 _LengthHeader = (u64) (sizeof(u64) + sizeof(u64));
+    // Allocate memory for compressed chunk buffer
+    // The compressed data is streamed through this buffer instead of being read at once
     if (!DynOS_Bin_Compress_Check(
-        (sLengthCompressed = (u64) f_tell(sFile)) >= _LengthHeader,
-        __FUNCTION__, aFilename.c_str(), "Empty file"
-    )) return NULL;
-
-    // Allocate memory for compressed buffer
-    if (!DynOS_Bin_Compress_Check(
-        (sBufferCompressed = (u8 *) calloc(sLengthCompressed - _LengthHeader, sizeof(u8))) != NULL,
+        (sBufferCompressed = (u8 *) calloc(DYNOS_BIN_DECOMPRESS_CHUNK_SIZE, sizeof(u8))) != NULL,
         __FUNCTION__, aFilename.c_str(), "Cannot allocate memory for decompression"
-    )) return NULL; else f_seek(sFile, _LengthHeader, SEEK_SET);
-
-    // Read input data
-    if (!DynOS_Bin_Compress_Check(
-        f_read(sBufferCompressed, sizeof(u8), sLengthCompressed - _LengthHeader, sFile) == sLengthCompressed - _LengthHeader,
-        __FUNCTION__, aFilename.c_str(), "Cannot read compressed data"
-    )) return NULL; else DynOS_Bin_Compress_Close();
+    )) return NULL;
 
     // Allocate memory for uncompressed buffer
+    // This buffer is directly handed over to the BinFile, no extra copy is made
     if (!DynOS_Bin_Compress_Check(
         (sBufferUncompressed = (u8 *) calloc(sLengthUncompressed, sizeof(u8))) != NULL,
         __FUNCTION__, aFilename.c_str(), "Cannot allocate memory for decompression"
     )) return NULL;
 
-    // Uncompress data
-    uLongf _LengthUncompressed = (uLongf)sLengthUncompressed;
-    int uncompressRc = uncompress(sBufferUncompressed, &_LengthUncompressed, sBufferCompressed, sLengthCompressed);
-    sLengthUncompressed = _LengthUncompressed;
+    // Uncompress data, one chunk at a time
+    z_stream _Stream = { 0 };
     if (!DynOS_Bin_Compress_Check(
-        uncompressRc == Z_OK,
+        inflateInit(&_Stream) == Z_OK,
+        __FUNCTION__, aFilename.c_str(), "Cannot initialize decompression stream"
+    )) return NULL;
+    _Stream.next_out = sBufferUncompressed;
+    _Stream.avail_out = (uInt) sLengthUncompressed;
+    int _Rc = Z_OK;
+    while (_Rc == Z_OK) {
+        size_t _LengthRead = f_read(sBufferCompressed, sizeof(u8), DYNOS_BIN_DECOMPRESS_CHUNK_SIZE, sFile);
+        if (_LengthRead == 0) { _Rc = Z_DATA_ERROR; break; }
+        sLengthCompressed += _LengthRead;
+        _Stream.next_in = sBufferCompressed;
+        _Stream.avail_in = (uInt) _LengthRead;
+        _Rc = inflate(&_Stream, Z_NO_FLUSH);
+        if (_Rc == Z_OK && _Stream.avail_out == 0 && _Stream.avail_in != 0) { _Rc = Z_BUF_ERROR; }
+    }
+    u64 _LengthOutput = (u64) _Stream.total_out;
+    inflateEnd(&_Stream);
+    if (!DynOS_Bin_Compress_Check(
+        _Rc == Z_STREAM_END && _LengthOutput == sLengthUncompressed,
         __FUNCTION__, aFilename.c_str(), "Cannot uncompress data"
     )) {
-        PrintError("ERROR: uncompress rc: %d, length uncompressed: %lu, length compressed: %lu, length header: %lu", uncompressRc, sLengthUncompressed, sLengthCompressed, _LengthHeader);
+        PrintError("ERROR: inflate rc: %d, length uncompressed: %llu, expected: %llu, length compressed: %llu", _Rc, (unsigned long long) _LengthOutput, (unsigned long long) sLengthUncompressed, (unsigned long long) sLengthCompressed);
         return NULL;
     }
-    Print("uncompress rc: %d, length uncompressed: %lu, length compressed: %lu, length header: %lu", uncompressRc, sLengthUncompressed, sLengthCompressed, _LengthHeader);
 
     // Return uncompressed data as a BinFile
-    BinFile *_BinFile = BinFile::OpenB(sBufferUncompressed, sLengthUncompressed);
+    BinFile *_BinFile = BinFile::OpenTake(sBufferUncompressed, (s32) sLengthUncompressed);
+    sBufferUncompressed = NULL;
     DynOS_Bin_Compress_Free();
     Print(" Done.");
     return _BinFile;
@@ -290,38 +290,19 @@ DataNode<TexData>* DynOS_Tex_Load(BinFile *aFile, GfxData *aGfxData) {
     return _Node;
 }
 
-DataNode<TexData>* DynOS_Tex_LoadFromBinary(const SysPath &aPackFolder, const SysPath &aFilename, const char *aTexName, bool aAddToPack) {
-    // Look for pack in cache
-    PackData* _Pack = DynOS_Pack_GetFromPath(aPackFolder);
-
-    // Look for tex in pack
-    if (_Pack) {
-        auto _Tex = DynOS_Pack_GetTex(_Pack, aTexName);
-        if (_Tex != NULL) {
-            return _Tex;
-        }
-    }
-
-    // Load data from binary file
-    DataNode<TexData>* _TexNode = NULL;
+DataNode<TexData>* DynOS_Tex_ReadBinary(const SysPath &aFilename) {
     BinFile *_File = BinFile::OpenR(aFilename.c_str());
     if (!_File) { return NULL; }
 
     u8 type = _File->Read<u8>();
     if (type == DATA_TYPE_TEXTURE) {
         // load png-texture
-        _TexNode = New<DataNode<TexData>>();
+        DataNode<TexData>* _TexNode = New<DataNode<TexData>>();
         _TexNode->mData = New<TexData>();
 
         _TexNode->mName.Read(_File);
         _TexNode->mData->mPngData.Read(_File);
         BinFile::Close(_File);
-
-        if (aAddToPack) {
-            if (!_Pack) { _Pack = DynOS_Pack_Add(aPackFolder); }
-            DynOS_Pack_AddTex(_Pack, _TexNode);
-        }
-
         return _TexNode;
     } else if (type != DATA_TYPE_TEXTURE_RAW) {
         BinFile::Close(_File);
@@ -329,7 +310,7 @@ DataNode<TexData>* DynOS_Tex_LoadFromBinary(const SysPath &aPackFolder, const Sy
     }
 
     // load raw-texture
-    _TexNode = New<DataNode<TexData>>();
+    DataNode<TexData>* _TexNode = New<DataNode<TexData>>();
     _TexNode->mData = New<TexData>();
 
     _TexNode->mName.Read(_File);
@@ -340,6 +321,24 @@ DataNode<TexData>* DynOS_Tex_LoadFromBinary(const SysPath &aPackFolder, const Sy
     _TexNode->mData->mRawData.Read(_File);
 
     BinFile::Close(_File);
+    return _TexNode;
+}
+
+DataNode<TexData>* DynOS_Tex_LoadFromBinary(const SysPath &aPackFolder, const SysPath &aFilename, const char *aTexName, bool aAddToPack) {
+    // Look for pack in cache
+    PackData* _Pack = DynOS_Pack_GetFromPath(aPackFolder);
+
+    // Look for tex in pack
+    if (_Pack) {
+        auto _Tex = DynOS_Pack_GetTex(_Pack, aTexName);
+        if (_Tex != NULL) {
+            return _Tex;
+        }
+    }
+
+    // Load data from binary file
+    DataNode<TexData>* _TexNode = DynOS_Tex_ReadBinary(aFilename);
+    if (!_TexNode) { return NULL; }
 
     if (aAddToPack) {
         if (!_Pack) { _Pack = DynOS_Pack_Add(aPackFolder); }
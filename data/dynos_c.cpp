@@ -17,8 +17,8 @@ void dynos_update_gfx() {
     return DynOS_UpdateGfx();
 }
 
-s32 dynos_tex_import(void **output, void *ptr, s32 tile, void *grapi, void **hashmap, void *pool, s32 *poolpos, s32 poolsize) {
-    return DynOS_Tex_Import(output, ptr, tile, grapi, hashmap, pool, (u32 *) poolpos, (u32) poolsize);
+s32 dynos_tex_import(void **output, void *ptr, s32 tile, void *grapi) {
+    return DynOS_Tex_Import(output, ptr, tile, grapi);
 }
 
 void dynos_gfx_swap_animations(void *ptr) {
@@ -93,6 +93,10 @@ void dynos_pack_set_enabled(s32 index, bool value) {
     }
 }
 
+void dynos_pack_shutdown(void) {
+    DynOS_Pack_Shutdown();
+}
+
 bool dynos_pack_get_exists(s32 index) {
     PackData* _Pack = DynOS_Pack_GetFromIndex(index);
     if (_Pack) {
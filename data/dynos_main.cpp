@@ -24,6 +24,7 @@ void *DynOS_UpdateCmd(void *aCmd) {
 
 void DynOS_UpdateGfx() {
     DynOS_Mod_Update();
+    DynOS_Pack_Update();
     DynOS_Tex_Update();
 }
 
@@ -1,15 +1,36 @@
+#include <atomic>
+#include <vector>
 #include "dynos.cpp.h"
 extern "C" {
 #include "engine/graph_node.h"
+#include "pc/thread.h"
 }
 
+// Pack bins are loaded (read, decompressed and parsed) on a loader thread.
+// The loader thread only reads files into its own lists, the loaded data is
+// handed over to the packs on the game thread, in the order the packs were enabled.
+// Until then the actors keep rendering their vanilla geo.
+struct PackLoader {
+    s32 mPackIndex;
+    SysPath mPath;
+    Array<Pair<const char *, GfxData *>> mGfxData;
+    Array<DataNode<TexData>*> mTextures;
+    struct ThreadHandle mThread;
+    std::atomic<bool> mDone;
+};
+
 static Array<PackData>& DynosPacks() {
     static Array<PackData> sDynosPacks;
     return sDynosPacks;
 }
 
-static void ScanPackBins(struct PackData* aPack) {
-    DIR *_PackDir = opendir(aPack->mPath.c_str());
+static std::vector<PackLoader *>& DynosPackLoaders() {
+    static std::vector<PackLoader *> sDynosPackLoaders;
+    return sDynosPackLoaders;
+}
+
+static void ScanPackBins(PackLoader* aLoader) {
+    DIR *_PackDir = opendir(aLoader->mPath.c_str());
     if (!_PackDir) { return; }
 
     struct dirent *_PackEnt = NULL;
@@ -18,23 +39,71 @@ static void ScanPackBins(struct PackData* aPack) {
         if (SysPath(_PackEnt->d_name) == ".") continue;
         if (SysPath(_PackEnt->d_name) == "..") continue;
 
-        SysPath _FileName = fstring("%s/%s", aPack->mPath.c_str(), _PackEnt->d_name);
+        SysPath _FileName = fstring("%s/%s", aLoader->mPath.c_str(), _PackEnt->d_name);
         s32 length = strlen(_PackEnt->d_name);
 
         // check for actors
         if (length > 4 && !strncmp(&_PackEnt->d_name[length - 4], ".bin", 4)) {
             String _ActorName = _PackEnt->d_name;
             _ActorName[length - 4] = '\0';
-            DynOS_Actor_LoadFromBinary(aPack->mPath, _ActorName.begin(), _FileName, true);
+            GfxData *_GfxData = DynOS_Actor_ReadBinary(_FileName);
+            if (_GfxData) {
+                aLoader->mGfxData.Add({ strdup(_ActorName.begin()), _GfxData });
+            }
         }
 
         // check for textures
         if (length > 4 && !strncmp(&_PackEnt->d_name[length - 4], ".tex", 4)) {
             String _TexName = _PackEnt->d_name;
             _TexName[length - 4] = '\0';
-            DynOS_Tex_LoadFromBinary(aPack->mPath, _FileName, _TexName.begin(), true);
+            DataNode<TexData> *_Tex = DynOS_Tex_ReadBinary(_FileName);
+            if (_Tex) {
+                aLoader->mTextures.Add(_Tex);
+            }
         }
     }
+    closedir(_PackDir);
+}
+
+static void *DynOS_Pack_LoaderThread(void *aArg) {
+    PackLoader *_Loader = (PackLoader *) aArg;
+    ScanPackBins(_Loader);
+    _Loader->mDone = true;
+    return NULL;
+}
+
+static void DynOS_Pack_LoadAsync(PackData* aPack) {
+    PackLoader *_Loader = new PackLoader();
+    _Loader->mPackIndex = aPack->mIndex;
+    _Loader->mPath = aPack->mPath;
+    _Loader->mDone = false;
+    aPack->mLoading = true;
+
+    // Fall back to loading synchronously if the thread can't be created
+    if (init_thread(&_Loader->mThread, DynOS_Pack_LoaderThread, _Loader, NULL, 0) != 0) {
+        _Loader->mThread.state = INVALID;
+        DynOS_Pack_LoaderThread(_Loader);
+    }
+    DynosPackLoaders().push_back(_Loader);
+}
+
+static void DynOS_Pack_JoinLoader(PackLoader *aLoader) {
+    if (aLoader->mThread.state == RUNNING) {
+        join_thread(&aLoader->mThread);
+    }
+}
+
+// Free whatever a loader read that wasn't handed over to its pack
+static void DynOS_Pack_FreeLoader(PackLoader *aLoader) {
+    for (auto& pair : aLoader->mGfxData) {
+        free((void *) pair.first);
+        DynOS_Gfx_Free(pair.second);
+    }
+    for (auto& _Tex : aLoader->mTextures) {
+        Delete(_Tex->mData);
+        Delete(_Tex);
+    }
+    delete aLoader;
 }
 
 static void DynOS_Pack_ActivateActor(s32 aPackIndex, Pair<const char *, GfxData *>& pair) {
@@ -93,9 +162,8 @@ void DynOS_Pack_SetEnabled(PackData* aPack, bool aEnabled) {
     if (aPack == NULL) { return; }
     aPack->mEnabled = aEnabled;
 
-    if (aEnabled && !aPack->mLoaded) {
-        ScanPackBins(aPack);
-        aPack->mLoaded = true;
+    if (aEnabled && !aPack->mLoaded && !aPack->mLoading) {
+        DynOS_Pack_LoadAsync(aPack);
     }
 
     if (aEnabled) {
@@ -116,6 +184,64 @@ void DynOS_Pack_SetEnabled(PackData* aPack, bool aEnabled) {
     DynOS_Actor_Override_All();
 }
 
+void DynOS_Pack_Update() {
+    auto& _Loaders = DynosPackLoaders();
+    if (_Loaders.empty()) { return; }
+
+    // Hand the loaded data over in the order the packs were enabled, so that
+    // overrides between packs don't depend on which loader finished first
+    bool _Activated = false;
+    while (!_Loaders.empty() && _Loaders.front()->mDone) {
+        PackLoader *_Loader = _Loaders.front();
+        _Loaders.erase(_Loaders.begin());
+        DynOS_Pack_JoinLoader(_Loader);
+
+        // Add the loaded data to the pack, activating it if the pack is still enabled
+        PackData* _Pack = DynOS_Pack_GetFromIndex(_Loader->mPackIndex);
+        Array<Pair<const char *, GfxData *>> _SkippedGfxData;
+        Array<DataNode<TexData>*> _SkippedTextures;
+        for (auto& pair : _Loader->mGfxData) {
+            if (_Pack && DynOS_Pack_GetActor(_Pack, pair.first) == NULL) {
+                DynOS_Pack_AddActor(_Pack, pair.first, pair.second);
+                free((void *) pair.first);
+                _Activated |= _Pack->mEnabled;
+            } else {
+                _SkippedGfxData.Add(pair);
+            }
+        }
+        for (auto& _Tex : _Loader->mTextures) {
+            if (_Pack && DynOS_Pack_GetTex(_Pack, _Tex->mName.begin()) == NULL) {
+                DynOS_Pack_AddTex(_Pack, _Tex);
+            } else {
+                _SkippedTextures.Add(_Tex);
+            }
+        }
+        if (_Pack) {
+            _Pack->mLoading = false;
+            _Pack->mLoaded = true;
+        }
+
+        _Loader->mGfxData = _SkippedGfxData;
+        _Loader->mTextures = _SkippedTextures;
+        DynOS_Pack_FreeLoader(_Loader);
+    }
+
+    if (_Activated) {
+        DynOS_Actor_Override_All();
+    }
+}
+
+void DynOS_Pack_Shutdown() {
+    auto& _Loaders = DynosPackLoaders();
+    for (PackLoader *_Loader : _Loaders) {
+        DynOS_Pack_JoinLoader(_Loader);
+        PackData* _Pack = DynOS_Pack_GetFromIndex(_Loader->mPackIndex);
+        if (_Pack) { _Pack->mLoading = false; }
+        DynOS_Pack_FreeLoader(_Loader);
+    }
+    _Loaders.clear();
+}
+
 PackData* DynOS_Pack_GetFromIndex(s32 aIndex) {
     auto& _DynosPacks = DynosPacks();
     if (aIndex < 0 || aIndex >= _DynosPacks.Count()) {
@@ -172,6 +298,7 @@ PackData* DynOS_Pack_Add(const SysPath& aPath) {
         .mGfxData = {},
         .mTextures = {},
         .mLoaded = false,
+        .mLoading = false,
     };
     _DynosPacks.Add(packData);
 
@@ -3,7 +3,9 @@
 #include "dynos.cpp.h"
 extern "C" {
 #include "pc/gfx/gfx.h"
+#include "pc/gfx/gfx_pc.h"
 #include "pc/gfx/gfx_rendering_api.h"
+#include "pc/gfx/gfx_texture_convert.h"
 }
 
 struct OverrideTexture {
@@ -47,169 +49,52 @@ static bool sDynosDumpTextureCache = false;
 // Conversion
 //
 
-static u8 *RGBA16_RGBA32(const u8 *aData, u64 aLength) {
-    u8 *_Buffer = New<u8>(aLength * 2);
-    u8 *pBuffer = _Buffer;
-    for (u64 i = 0; i != aLength; i += 2) {
-        u16 _Col  = (aData[i + 0] << 8) | aData[i + 1];
-        u8  _Red  = (_Col >> 11) & 0x1F;
-        u8  _Grn  = (_Col >>  6) & 0x1F;
-        u8  _Blu  = (_Col >>  1) & 0x1F;
-        u8  _Alp  = (_Col >>  0) & 0x01;
-        *(pBuffer++) = (SCALE_5_8(_Red));
-        *(pBuffer++) = (SCALE_5_8(_Grn));
-        *(pBuffer++) = (SCALE_5_8(_Blu));
-        *(pBuffer++) = (0xFF  *  (_Alp));
+// The converted data is written into a scratch buffer reused by every conversion on the same thread
+static u8 *DynOS_Tex_GetScratchBuffer(u64 aSize) {
+    static thread_local u8 *sScratchBuffer = NULL;
+    static thread_local u64 sScratchSize = 0;
+    if (aSize > sScratchSize) {
+        free(sScratchBuffer);
+        sScratchBuffer = (u8 *) malloc(aSize);
+        sScratchSize = sScratchBuffer ? aSize : 0;
     }
-    return _Buffer;
-}
-
-static u8 *RGBA32_RGBA32(const u8 *aData, u64 aLength) {
-    u8 *_Buffer = New<u8>(aLength * 1);
-    memcpy(_Buffer, aData, aLength);
-    return _Buffer;
-}
-
-static u8 *IA4_RGBA32(const u8 *aData, u64 aLength) {
-    u8 *_Buffer = New<u8>(aLength * 8);
-    u8 *pBuffer = _Buffer;
-    for (u64 i = 0; i != aLength; ++i) {
-        u8 _Half0 = (aData[i] >> 4) & 0xF;
-        *(pBuffer++) = (SCALE_3_8(_Half0 >> 1));
-        *(pBuffer++) = (SCALE_3_8(_Half0 >> 1));
-        *(pBuffer++) = (SCALE_3_8(_Half0 >> 1));
-        *(pBuffer++) = (0xFF  *  (_Half0 &  1));
-
-        u8 _Half1 = (aData[i] >> 0) & 0xF;
-        *(pBuffer++) = (SCALE_3_8(_Half1 >> 1));
-        *(pBuffer++) = (SCALE_3_8(_Half1 >> 1));
-        *(pBuffer++) = (SCALE_3_8(_Half1 >> 1));
-        *(pBuffer++) = (0xFF  *  (_Half1 &  1));
-    }
-    return _Buffer;
-}
-
-static u8 *IA8_RGBA32(const u8 *aData, u64 aLength) {
-    u8 *_Buffer = New<u8>(aLength * 4);
-    u8 *pBuffer = _Buffer;
-    for (u64 i = 0; i != aLength; ++i) {
-        u8 _Col   = (aData[i] >> 4) & 0xF;
-        u8 _Alp   = (aData[i] >> 0) & 0xF;
-        *(pBuffer++) = (SCALE_4_8(_Col));
-        *(pBuffer++) = (SCALE_4_8(_Col));
-        *(pBuffer++) = (SCALE_4_8(_Col));
-        *(pBuffer++) = (SCALE_4_8(_Alp));
-    }
-    return _Buffer;
-}
-
-static u8 *IA16_RGBA32(const u8 *aData, u64 aLength) {
-    u8 *_Buffer = New<u8>(aLength * 2);
-    u8 *pBuffer = _Buffer;
-    for (u64 i = 0; i != aLength; i += 2) {
-        u8 _Col   = aData[i + 0];
-        u8 _Alp   = aData[i + 1];
-        *(pBuffer++) = (_Col);
-        *(pBuffer++) = (_Col);
-        *(pBuffer++) = (_Col);
-        *(pBuffer++) = (_Alp);
-    }
-    return _Buffer;
-}
-
-static u8 *CI4_RGBA32(const u8 *aData, u64 aLength, const u8 *aPalette) {
-    if (!aPalette) { return NULL; }
-    u8 *_Buffer = New<u8>(aLength * 8);
-    u8 *pBuffer = _Buffer;
-    for (u64 i = 0; i != aLength; ++i) {
-        u8  _Idx0 = (aData[i] >> 4) & 0xF;
-        u16 _Col0 = (aPalette[_Idx0 * 2 + 0] << 8) | aPalette[_Idx0 * 2 + 1];
-        u8  _Red0 = (_Col0 >> 11) & 0x1F;
-        u8  _Grn0 = (_Col0 >>  6) & 0x1F;
-        u8  _Blu0 = (_Col0 >>  1) & 0x1F;
-        u8  _Alp0 = (_Col0 >>  0) & 0x01;
-        *(pBuffer++) = (SCALE_5_8(_Red0));
-        *(pBuffer++) = (SCALE_5_8(_Grn0));
-        *(pBuffer++) = (SCALE_5_8(_Blu0));
-        *(pBuffer++) = (0xFF  *  (_Alp0));
-
-        u8  _Idx1 = (aData[i] >> 0) & 0xF;
-        u16 _Col1 = (aPalette[_Idx1 * 2 + 0] << 8) | aPalette[_Idx1 * 2 + 1];
-        u8  _Red1 = (_Col1 >> 11) & 0x1F;
-        u8  _Grn1 = (_Col1 >>  6) & 0x1F;
-        u8  _Blu1 = (_Col1 >>  1) & 0x1F;
-        u8  _Alp1 = (_Col1 >>  0) & 0x01;
-        *(pBuffer++) = (SCALE_5_8(_Red1));
-        *(pBuffer++) = (SCALE_5_8(_Grn1));
-        *(pBuffer++) = (SCALE_5_8(_Blu1));
-        *(pBuffer++) = (0xFF  *  (_Alp1));
-    }
-    return _Buffer;
-}
-
-static u8 *CI8_RGBA32(const u8 *aData, u64 aLength, const u8 *aPalette) {
-    if (!aPalette) { return NULL; }
-    u8 *_Buffer = New<u8>(aLength * 4);
-    u8 *pBuffer = _Buffer;
-    for (u64 i = 0; i != aLength; ++i) {
-        u8  _Idx  = aData[i];
-        u16 _Col  = (aPalette[_Idx * 2 + 0] << 8) | aPalette[_Idx * 2 + 1];
-        u8  _Red  = (_Col >> 11) & 0x1F;
-        u8  _Grn  = (_Col >>  6) & 0x1F;
-        u8  _Blu  = (_Col >>  1) & 0x1F;
-        u8  _Alp  = (_Col >>  0) & 0x01;
-        *(pBuffer++) = (SCALE_5_8(_Red));
-        *(pBuffer++) = (SCALE_5_8(_Grn));
-        *(pBuffer++) = (SCALE_5_8(_Blu));
-        *(pBuffer++) = (0xFF  *  (_Alp));
-    }
-    return _Buffer;
-}
-
-static u8 *I4_RGBA32(const u8 *aData, u64 aLength) {
-    u8 *_Buffer = New<u8>(aLength * 8);
-    u8 *pBuffer = _Buffer;
-    for (u64 i = 0; i != aLength; ++i) {
-        u8 _Half0 = (aData[i] >> 4) & 0xF;
-        *(pBuffer++) = (SCALE_4_8(_Half0));
-        *(pBuffer++) = (SCALE_4_8(_Half0));
-        *(pBuffer++) = (SCALE_4_8(_Half0));
-        *(pBuffer++) = (255);
-
-        u8 _Half1 = (aData[i] >> 0) & 0xF;
-        *(pBuffer++) = (SCALE_4_8(_Half1));
-        *(pBuffer++) = (SCALE_4_8(_Half1));
-        *(pBuffer++) = (SCALE_4_8(_Half1));
-        *(pBuffer++) = (255);
-    }
-    return _Buffer;
-}
-
-static u8 *I8_RGBA32(const u8 *aData, u64 aLength) {
-    u8 *_Buffer = New<u8>(aLength * 4);
-    u8 *pBuffer = _Buffer;
-    for (u64 i = 0; i != aLength; ++i) {
-        *(pBuffer++) = (aData[i]);
-        *(pBuffer++) = (aData[i]);
-        *(pBuffer++) = (aData[i]);
-        *(pBuffer++) = (255);
-    }
-    return _Buffer;
+    return sScratchBuffer;
 }
 
 u8 *DynOS_Tex_ConvertToRGBA32(const u8 *aData, u64 aLength, s32 aFormat, s32 aSize, const u8 *aPalette) {
+    u8 *_Buffer = NULL;
     switch   ((aFormat       << 8) | aSize       ) {
-        case ((G_IM_FMT_RGBA << 8) | G_IM_SIZ_16b): return RGBA16_RGBA32(aData, aLength);
-        case ((G_IM_FMT_RGBA << 8) | G_IM_SIZ_32b): return RGBA32_RGBA32(aData, aLength);
-        case ((G_IM_FMT_IA   << 8) | G_IM_SIZ_4b ): return IA4_RGBA32   (aData, aLength);
-        case ((G_IM_FMT_IA   << 8) | G_IM_SIZ_8b ): return IA8_RGBA32   (aData, aLength);
-        case ((G_IM_FMT_IA   << 8) | G_IM_SIZ_16b): return IA16_RGBA32  (aData, aLength);
-        case ((G_IM_FMT_CI   << 8) | G_IM_SIZ_4b ): return CI4_RGBA32   (aData, aLength, aPalette);
-        case ((G_IM_FMT_CI   << 8) | G_IM_SIZ_8b ): return CI8_RGBA32   (aData, aLength, aPalette);
-        case ((G_IM_FMT_I    << 8) | G_IM_SIZ_4b ): return I4_RGBA32    (aData, aLength);
-        case ((G_IM_FMT_I    << 8) | G_IM_SIZ_8b ): return I8_RGBA32    (aData, aLength);
+        case ((G_IM_FMT_RGBA << 8) | G_IM_SIZ_16b):
+            if ((_Buffer = DynOS_Tex_GetScratchBuffer(aLength * 2))) { gfx_convert_rgba16_rgba32(_Buffer, aData, aLength / 2); }
+            break;
+        case ((G_IM_FMT_RGBA << 8) | G_IM_SIZ_32b):
+            if ((_Buffer = DynOS_Tex_GetScratchBuffer(aLength * 1))) { memcpy(_Buffer, aData, aLength); }
+            break;
+        case ((G_IM_FMT_IA   << 8) | G_IM_SIZ_4b ):
+            if ((_Buffer = DynOS_Tex_GetScratchBuffer(aLength * 8))) { gfx_convert_ia4_rgba32(_Buffer, aData, aLength * 2); }
+            break;
+        case ((G_IM_FMT_IA   << 8) | G_IM_SIZ_8b ):
+            if ((_Buffer = DynOS_Tex_GetScratchBuffer(aLength * 4))) { gfx_convert_ia8_rgba32(_Buffer, aData, aLength); }
+            break;
+        case ((G_IM_FMT_IA   << 8) | G_IM_SIZ_16b):
+            if ((_Buffer = DynOS_Tex_GetScratchBuffer(aLength * 2))) { gfx_convert_ia16_rgba32(_Buffer, aData, aLength / 2); }
+            break;
+        case ((G_IM_FMT_CI   << 8) | G_IM_SIZ_4b ):
+            if (!aPalette) { return NULL; }
+            if ((_Buffer = DynOS_Tex_GetScratchBuffer(aLength * 8))) { gfx_convert_ci4_rgba32(_Buffer, aData, aLength * 2, aPalette); }
+            break;
+        case ((G_IM_FMT_CI   << 8) | G_IM_SIZ_8b ):
+            if (!aPalette) { return NULL; }
+            if ((_Buffer = DynOS_Tex_GetScratchBuffer(aLength * 4))) { gfx_convert_ci8_rgba32(_Buffer, aData, aLength, aPalette); }
+            break;
+        case ((G_IM_FMT_I    << 8) | G_IM_SIZ_4b ):
+            if ((_Buffer = DynOS_Tex_GetScratchBuffer(aLength * 8))) { gfx_convert_i4_rgba32(_Buffer, aData, aLength * 2); }
+            break;
+        case ((G_IM_FMT_I    << 8) | G_IM_SIZ_8b ):
+            if ((_Buffer = DynOS_Tex_GetScratchBuffer(aLength * 4))) { gfx_convert_i8_rgba32(_Buffer, aData, aLength); }
+            break;
     }
-    return NULL;
+    return _Buffer;
 }
 
 //
@@ -229,44 +114,14 @@ static void DynOS_Tex_Upload(DataNode<TexData> *aNode, GRAPI *aGfxRApi, s32 aTil
 
 typedef struct TextureHashmapNode THN;
 
-static bool DynOS_Tex_Cache(THN **aOutput, DataNode<TexData> *aNode, s32 aTile, GRAPI *aGfxRApi, THN **aHashMap, THN *aPool, u32 *aPoolPos, u32 aPoolSize) {
-
-    // Find texture in cache
-    uintptr_t _Hash = ((uintptr_t) aNode) & ((aPoolSize * 2) - 1);
-    THN **_Node = &(aHashMap[_Hash]);
-    while ((*_Node) != NULL && ((*_Node) - aPool) < (*aPoolPos)) {
-        if ((*_Node)->texture_addr == (const void *) aNode) {
-            aGfxRApi->select_texture(aTile, (*_Node)->texture_id);
-            if (!aNode->mData->mUploaded) {
-                DynOS_Tex_Upload(aNode, aGfxRApi, aTile, (*_Node)->texture_id);
-            }
-            (*aOutput) = (*_Node);
-            return true;
+// DynOS textures share the gfx texture cache, keyed by their data node
+static bool DynOS_Tex_Cache(THN **aOutput, DataNode<TexData> *aNode, s32 aTile, GRAPI *aGfxRApi) {
+    if (gfx_texture_cache_lookup(aTile, aOutput, (const void *) aNode, G_IM_FMT_RGBA, G_IM_SIZ_32b)) {
+        if (!aNode->mData->mUploaded) {
+            DynOS_Tex_Upload(aNode, aGfxRApi, aTile, (*aOutput)->texture_id);
         }
-        _Node = &(*_Node)->next;
-    }
-
-    // If cache is full, clear cache
-    if ((*aPoolPos) == aPoolSize) {
-        (*aPoolPos) = 0;
-        _Node = &aHashMap[_Hash];
-    }
-
-    // Add new texture to cache
-    (*_Node) = &aPool[(*aPoolPos)++];
-    if (!(*_Node)->texture_addr) {
-        (*_Node)->texture_id = aGfxRApi->new_texture();
+        return true;
     }
-    aGfxRApi->select_texture(aTile, (*_Node)->texture_id);
-    aGfxRApi->set_sampler_parameters(aTile, false, 0, 0);
-    (*_Node)->next = NULL;
-    (*_Node)->texture_addr = aNode;
-    (*_Node)->fmt = G_IM_FMT_RGBA;
-    (*_Node)->siz = G_IM_SIZ_32b;
-    (*_Node)->cms = 0;
-    (*_Node)->cmt = 0;
-    (*_Node)->linear_filter = false;
-    (*aOutput) = (*_Node);
     return false;
 }
 
@@ -333,10 +188,10 @@ static DataNode<TexData> *DynOS_Tex_RetrieveNode(void *aPtr) {
     return NULL;
 }
 
-static bool DynOS_Tex_Import_Typed(THN **aOutput, void *aPtr, s32 aTile, GRAPI *aGfxRApi, THN **aHashMap, THN *aPool, u32 *aPoolPos, u32 aPoolSize) {
+static bool DynOS_Tex_Import_Typed(THN **aOutput, void *aPtr, s32 aTile, GRAPI *aGfxRApi) {
     DataNode<TexData> *_Node = DynOS_Tex_RetrieveNode(aPtr);
     if (_Node) {
-        if (!DynOS_Tex_Cache(aOutput, _Node, aTile, aGfxRApi, aHashMap, aPool, aPoolPos, aPoolSize)) {
+        if (!DynOS_Tex_Cache(aOutput, _Node, aTile, aGfxRApi)) {
             DynOS_Tex_Upload(_Node, aGfxRApi, aTile, (*aOutput)->texture_id);
         }
         return true;
@@ -344,16 +199,12 @@ static bool DynOS_Tex_Import_Typed(THN **aOutput, void *aPtr, s32 aTile, GRAPI *
     return false;
 }
 
-bool DynOS_Tex_Import(void **aOutput, void *aPtr, s32 aTile, void *aGfxRApi, void **aHashMap, void *aPool, u32 *aPoolPos, u32 aPoolSize) {
+bool DynOS_Tex_Import(void **aOutput, void *aPtr, s32 aTile, void *aGfxRApi) {
     return DynOS_Tex_Import_Typed(
         (THN **)  aOutput,
         (void *)  aPtr,
         (s32)     aTile,
-        (GRAPI *) aGfxRApi,
-        (THN **)  aHashMap,
-        (THN *)   aPool,
-        (u32 *)   aPoolPos,
-        (u32)     aPoolSize
+        (GRAPI *) aGfxRApi
     );
 }
 
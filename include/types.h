@@ -255,6 +255,7 @@ struct Object
     Collision *collisionData;
     void *respawnInfo;
     void (*areaTimerRunOnceCallback)(void);
+    void (*areaTimerFastForwardCallback)(u32 ticks);
     const BehaviorScript *behavior;
     const BehaviorScript *curBhvCommand;
     uintptr_t bhvStack[OBJECT_MAX_BHV_STACK];
@@ -834,30 +834,33 @@ void create_next_audio_buffer(s16 *samples, u32 num_samples) {
  */
 extern f32 *smlua_get_vec3f_for_play_sound(f32 *pos);
 
+/**
+ * The sound request ring has a single producer (the game thread) and a single consumer
+ * (the audio thread), so it doesn't need the audio mutex: the request is written first
+ * and only then published by storing the new count.
+ */
+static void queue_sound_request(s32 soundBits, f32 *pos, f32 freqScale) {
+    u8 index = __atomic_load_n(&sSoundRequestCount, __ATOMIC_RELAXED);
+
+    // drop the request when the ring is full instead of overwriting unprocessed ones
+    if ((u8)(index + 1) == __atomic_load_n(&sNumProcessedSoundRequests, __ATOMIC_ACQUIRE)) { return; }
+
+    sSoundRequests[index].soundBits = soundBits;
+    sSoundRequests[index].position = pos;
+    sSoundRequests[index].customFreqScale = freqScale;
+    __atomic_store_n(&sSoundRequestCount, (u8)(index + 1), __ATOMIC_RELEASE);
+}
+
 void play_sound(s32 soundBits, f32 *pos) {
-    MUTEX_LOCK(gAudioThread);
-    
     pos = smlua_get_vec3f_for_play_sound(pos);
     smlua_call_event_hooks_on_play_sound(HOOK_ON_PLAY_SOUND, soundBits, pos, &soundBits);
-    sSoundRequests[sSoundRequestCount].soundBits = soundBits;
-    sSoundRequests[sSoundRequestCount].position = pos;
-    sSoundRequests[sSoundRequestCount].customFreqScale = 0;
-    sSoundRequestCount++;
-    
-    MUTEX_UNLOCK(gAudioThread);
+    queue_sound_request(soundBits, pos, 0);
 }
 
 void play_sound_with_freq_scale(s32 soundBits, f32* pos, f32 freqScale) {
-    MUTEX_LOCK(gAudioThread);
-    
     pos = smlua_get_vec3f_for_play_sound(pos);
     smlua_call_event_hooks_on_play_sound(HOOK_ON_PLAY_SOUND, soundBits, pos, &soundBits);
-    sSoundRequests[sSoundRequestCount].soundBits = soundBits;
-    sSoundRequests[sSoundRequestCount].position = pos;
-    sSoundRequests[sSoundRequestCount].customFreqScale = freqScale;
-    sSoundRequestCount++;
-    
-    MUTEX_UNLOCK(gAudioThread);
+    queue_sound_request(soundBits, pos, freqScale);
 }
 
 /**
@@ -960,10 +963,11 @@ static void process_sound_request(u32 bits, f32 *pos, f32 freqScale) {
 static void process_all_sound_requests(void) {
     struct Sound *sound;
 
-    while (sSoundRequestCount != sNumProcessedSoundRequests) {
+    u8 count = __atomic_load_n(&sSoundRequestCount, __ATOMIC_ACQUIRE);
+    while (count != sNumProcessedSoundRequests) {
         sound = &sSoundRequests[sNumProcessedSoundRequests];
         process_sound_request(sound->soundBits, sound->position, sound->customFreqScale);
-        sNumProcessedSoundRequests++;
+        __atomic_store_n(&sNumProcessedSoundRequests, (u8)(sNumProcessedSoundRequests + 1), __ATOMIC_RELEASE);
     }
 }
 
@@ -994,9 +998,9 @@ static void delete_sound_from_bank(u8 bank, u8 soundIndex) {
  * Called from threads: thread3_main, thread4_sound, thread5_game_loop
  */
 static void update_background_music_after_sound(u8 bank, u8 soundIndex) {
+    if (bank >= SOUND_BANK_COUNT || soundIndex >= SOUND_INDEX_COUNT) { return; }
     MUTEX_LOCK(gAudioThread);
     
-    if (bank >= SOUND_BANK_COUNT || soundIndex >= SOUND_INDEX_COUNT) { return; }
     if (sSoundBanks[bank][soundIndex].soundBits & SOUND_LOWER_BACKGROUND_MUSIC) {
         sSoundBanksThatLowerBackgroundMusic &= (1 << bank) ^ 0xffff;
         begin_background_music_fade(50);
@@ -1773,9 +1777,9 @@ static void update_game_sound(void) {
  * Called from threads: thread4_sound, thread5_game_loop
  */
 static void seq_player_play_sequence(u8 player, u8 seqId, u16 arg2) {
+    if (player >= SEQUENCE_PLAYERS) { return; }
     MUTEX_LOCK(gAudioThread);
     
-    if (player >= SEQUENCE_PLAYERS) { return; }
     u8 targetVolume;
     u8 i;
 
@@ -1823,9 +1827,9 @@ static void seq_player_play_sequence(u8 player, u8 seqId, u16 arg2) {
  * Called from threads: thread5_game_loop
  */
 void seq_player_fade_out(u8 player, u16 fadeDuration) {
+    if (player >= SEQUENCE_PLAYERS) { return; }
     MUTEX_LOCK(gAudioThread);
     
-    if (player >= SEQUENCE_PLAYERS) { return; }
 #if defined(VERSION_EU) || defined(VERSION_SH)
 #ifdef VERSION_EU
     u32 fd = fadeDuration;
@@ -1860,11 +1864,11 @@ void fade_volume_scale(u8 player, u8 targetScale, u16 fadeDuration) {
  * Called from threads: thread3_main, thread4_sound, thread5_game_loop
  */
 static void fade_channel_volume_scale(u8 player, u8 channelIndex, u8 targetScale, u16 fadeDuration) {
+    if (player >= SEQUENCE_PLAYERS) { return; }
+    if (channelIndex >= CHANNELS_MAX) { return; }
     MUTEX_LOCK(gAudioThread);
     
     struct ChannelVolumeScaleFade *temp;
-    if (player >= SEQUENCE_PLAYERS) { return; }
-    if (channelIndex >= CHANNELS_MAX) { return; }
 
     if (gSequencePlayers[player].channels[channelIndex] != &gSequenceChannelNone) {
         temp = &sVolumeScaleFades[player][channelIndex];
@@ -2083,9 +2087,9 @@ void unused_8031FED0(u8 player, u32 bits, s8 arg2) {
  * Called from threads: thread5_game_loop
  */
 void seq_player_lower_volume(u8 player, u16 fadeDuration, u8 percentage) {
+    if (player >= SEQUENCE_PLAYERS) { return; }
     MUTEX_LOCK(gAudioThread);
     
-    if (player >= SEQUENCE_PLAYERS) { return; }
     if (player == SEQ_PLAYER_LEVEL) {
         sLowerBackgroundMusicVolume = TRUE;
         begin_background_music_fade(fadeDuration);
@@ -2105,9 +2109,9 @@ void seq_player_lower_volume(u8 player, u16 fadeDuration, u8 percentage) {
  * Called from threads: thread5_game_loop
  */
 void seq_player_unlower_volume(u8 player, u16 fadeDuration) {
+    if (player >= SEQUENCE_PLAYERS) { return; }
     MUTEX_LOCK(gAudioThread);
     
-    if (player >= SEQUENCE_PLAYERS) { return; }
     sLowerBackgroundMusicVolume = FALSE;
     if (player == SEQ_PLAYER_LEVEL) {
         if (gSequencePlayers[player].state != SEQUENCE_PLAYER_STATE_FADE_OUT) {
@@ -2301,7 +2305,7 @@ void stop_sound(u32 soundBits, f32 *pos) {
     
     pos = smlua_get_vec3f_for_play_sound(pos);
     u8 bank = (soundBits & SOUNDARGS_MASK_BANK) >> SOUNDARGS_SHIFT_BANK;
-    if (bank >= SOUND_BANK_COUNT) { return; }
+    if (bank >= SOUND_BANK_COUNT) { MUTEX_UNLOCK(gAudioThread); return; }
     u8 soundIndex = sSoundBanks[bank][0].next;
 
     while (soundIndex != 0xff) {
@@ -2353,9 +2357,9 @@ void stop_sounds_from_source(f32 *pos) {
  * Called from threads: thread3_main, thread5_game_loop
  */
 static void stop_sounds_in_bank(u8 bank) {
+    if (bank >= SOUND_BANK_COUNT) { return; }
     MUTEX_LOCK(gAudioThread);
     
-    if (bank >= SOUND_BANK_COUNT) { return; }
     u8 soundIndex = sSoundBanks[bank][0].next;
 
     while (soundIndex != 0xff) {
@@ -2505,9 +2509,9 @@ void set_sequence_player_volume(s32 player, f32 volume) {
  * Called from threads: thread5_game_loop
  */
 void play_music(u8 player, u16 seqArgs, u16 fadeTimer) {
+    if (player >= SEQUENCE_PLAYERS) { return; }
     MUTEX_LOCK(gAudioThread);
     
-    if (player >= SEQUENCE_PLAYERS) { return; }
     u8 seqId = seqArgs & 0xff;
     u8 priority = seqArgs >> 8;
     u8 i;
@@ -2519,12 +2523,14 @@ void play_music(u8 player, u16 seqArgs, u16 fadeTimer) {
     // sequences. Just play them immediately, stopping any old sequence.
     if (player != SEQ_PLAYER_LEVEL) {
         seq_player_play_sequence(player, seqId, fadeTimer);
+        MUTEX_UNLOCK(gAudioThread);
         return;
     }
 
     // Abort if the queue is already full.
     if (sBackgroundMusicQueueSize == MAX_BACKGROUND_MUSIC_QUEUE_SIZE) {
         LOG_DEBUG("Background music queue reached max size! Ignoring request to queue sequence %d.", seqId);
+        MUTEX_UNLOCK(gAudioThread);
         return;
     }
 
@@ -2539,6 +2545,7 @@ void play_music(u8 player, u16 seqArgs, u16 fadeTimer) {
                 stop_background_music(sBackgroundMusicQueue[0].seqId);
             }
             //LOG_DEBUG("Sequence 0x%X is already in the background music queue!", seqId);
+            MUTEX_UNLOCK(gAudioThread);
             return;
         }
     }
@@ -2583,6 +2590,7 @@ void stop_background_music(u16 seqId) {
     u8 i;
 
     if (sBackgroundMusicQueueSize == 0) {
+        MUTEX_UNLOCK(gAudioThread);
         return;
     }
 
@@ -2725,6 +2733,7 @@ void play_secondary_music(u8 seqId, u8 bgMusicVolume, u8 volume, u16 fadeTimer)
 
     sUnused80332118 = 0;
     if (sCurrentBackgroundMusicSeqId == 0xff || sCurrentBackgroundMusicSeqId == SEQ_MENU_TITLE_SCREEN) {
+        MUTEX_UNLOCK(gAudioThread);
         return;
     }
 
@@ -2767,6 +2776,7 @@ void set_audio_fadeout(u16 fadeDuration) {
     MUTEX_LOCK(gAudioThread);
     
     if (sHasStartedFadeOut) {
+        MUTEX_UNLOCK(gAudioThread);
         return;
     }
 
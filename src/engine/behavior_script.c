@@ -1275,9 +1275,31 @@ static BhvCommandProc BehaviorCmdTable[BEHAVIOR_CMD_TABLE_MAX] = {
     bhv_cmd_load_collision_data_ext, //41
 };
 
+// Objects that fell behind the network area timer re-run their behavior until they caught up.
+// Bound the extra ticks per object and per frame so that a late join or a long pause is caught up
+// over several frames instead of stalling a single one.
+#define AREA_TIMER_CATCHUP_TICKS_PER_OBJECT 30
+#define AREA_TIMER_CATCHUP_TICKS_PER_FRAME 900
+
+static u32 sAreaTimerCatchupFrame = 0;
+static u32 sAreaTimerCatchupTicks = 0;
+
+static bool area_timer_can_catch_up(u32 *objectTicks) {
+    if (sAreaTimerCatchupFrame != gGlobalTimer) {
+        sAreaTimerCatchupFrame = gGlobalTimer;
+        sAreaTimerCatchupTicks = 0;
+    }
+    if (*objectTicks >= AREA_TIMER_CATCHUP_TICKS_PER_OBJECT) { return false; }
+    if (sAreaTimerCatchupTicks >= AREA_TIMER_CATCHUP_TICKS_PER_FRAME) { return false; }
+    (*objectTicks)++;
+    sAreaTimerCatchupTicks++;
+    return true;
+}
+
 // Execute the behavior script of the current object, process the object flags, and other miscellaneous code for updating objects.
 void cur_obj_update(void) {
     if (!gCurrentObject) { return; }
+    u32 catchupTicks = 0;
     // Don't update if dormant
     if (gCurrentObject->activeFlags & ACTIVE_FLAG_DORMANT) {
         gCurrentObject->header.gfx.node.flags &= ~GRAPH_RENDER_ACTIVE;
@@ -1314,6 +1336,13 @@ void cur_obj_update(void) {
             }
         }
 
+        // let the behavior skip ahead in closed form, the regular update below runs the last tick
+        if (gCurrentObject->areaTimerFastForwardCallback != NULL && gCurrentObject->areaTimer + 1 < gNetworkAreaTimer) {
+            u32 ticks = gNetworkAreaTimer - gCurrentObject->areaTimer - 1;
+            gCurrentObject->areaTimerFastForwardCallback(ticks);
+            gCurrentObject->areaTimer += ticks;
+        }
+
         // cancel object update if it's running faster than the timer
         if (gCurrentObject->areaTimer > gNetworkAreaTimer) {
             goto cur_obj_update_end;
@@ -1438,7 +1467,7 @@ cur_obj_update_begin:;
     // update network area timer
     if (gCurrentObject->areaTimerType != AREA_TIMER_TYPE_NONE && !network_check_singleplayer_pause()) {
         gCurrentObject->areaTimer++;
-        if (gCurrentObject->areaTimer < gNetworkAreaTimer) {
+        if (gCurrentObject->areaTimer < gNetworkAreaTimer && area_timer_can_catch_up(&catchupTicks)) {
             goto cur_obj_update_begin;
         }
     }
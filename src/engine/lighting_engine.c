@@ -1,3 +1,5 @@
+#include <stdlib.h>
+#include <string.h>
 #include "lighting_engine.h"
 #include "math_util.h"
 #include "surface_collision.h"
@@ -7,16 +9,122 @@
 #define LE_MAX_LIGHTS 256
 #define LE_TOTAL_WEIGHTED_LIGHTING
 
+// Lights are binned into a coarse grid so that each position only tests the lights that can reach it.
+// Positions outside of the grid use the closest cell on the edge.
+#define LE_GRID_SIZE 16
+#define LE_GRID_CELL_SIZE 2048
+#define LE_GRID_MIN (-(LE_GRID_SIZE * LE_GRID_CELL_SIZE) / 2)
+#define LE_GRID_CELLS (LE_GRID_SIZE * LE_GRID_SIZE * LE_GRID_SIZE)
+
 static Color sAmbientColor;
 static void* sLights = NULL;
 static s32 sLightID = 0;
 
+// packed copy of the lights, in hmap order, rebuilt when a light changes
+static struct LELight sLightsPacked[LE_MAX_LIGHTS];
+static f32 sLightsRadiusSq[LE_MAX_LIGHTS];
+static s32 sLightsPackedCount = 0;
+static bool sLightsDirty = true;
+
+// light indices of each cell are sGridLights[sGridStart[cell]] to sGridLights[sGridStart[cell + 1] - 1]
+static u32 sGridStart[LE_GRID_CELLS + 1];
+static u8* sGridLights = NULL;
+static u32 sGridLightsCapacity = 0;
+
 static inline void color_set(Color color, u8 r, u8 g, u8 b) {
     color[0] = r;
     color[1] = g;
     color[2] = b;
 }
 
+static inline s32 le_grid_coord(f32 value) {
+    // clamped before the cast, huge or infinite radii would overflow it (NaN also ends up in cell 0)
+    f32 coord = floorf((value - LE_GRID_MIN) / LE_GRID_CELL_SIZE);
+    if (!(coord > 0.0f)) { return 0; }
+    if (coord > (f32) (LE_GRID_SIZE - 1)) { return LE_GRID_SIZE - 1; }
+    return (s32) coord;
+}
+
+static inline s32 le_grid_cell(s32 x, s32 y, s32 z) {
+    return (z * LE_GRID_SIZE + y) * LE_GRID_SIZE + x;
+}
+
+static void le_light_grid_range(struct LELight* light, s32 min[3], s32 max[3]) {
+    f32 radius = fabsf(light->radius);
+    min[0] = le_grid_coord(light->posX - radius);
+    min[1] = le_grid_coord(light->posY - radius);
+    min[2] = le_grid_coord(light->posZ - radius);
+    max[0] = le_grid_coord(light->posX + radius);
+    max[1] = le_grid_coord(light->posY + radius);
+    max[2] = le_grid_coord(light->posZ + radius);
+}
+
+static void le_rebuild_lights(void) {
+    sLightsDirty = false;
+
+    // pack the lights
+    sLightsPackedCount = 0;
+    for (struct LELight* light = hmap_begin(sLights); light != NULL; light = hmap_next(sLights)) {
+        if (sLightsPackedCount >= LE_MAX_LIGHTS) { break; }
+        sLightsPacked[sLightsPackedCount] = *light;
+        sLightsRadiusSq[sLightsPackedCount] = light->radius * light->radius;
+        sLightsPackedCount++;
+    }
+
+    // count the lights overlapping each cell
+    memset(sGridStart, 0, sizeof(sGridStart));
+    for (s32 i = 0; i < sLightsPackedCount; i++) {
+        s32 min[3], max[3];
+        le_light_grid_range(&sLightsPacked[i], min, max);
+        for (s32 z = min[2]; z <= max[2]; z++) {
+            for (s32 y = min[1]; y <= max[1]; y++) {
+                for (s32 x = min[0]; x <= max[0]; x++) {
+                    sGridStart[le_grid_cell(x, y, z) + 1]++;
+                }
+            }
+        }
+    }
+    for (s32 i = 0; i < LE_GRID_CELLS; i++) {
+        sGridStart[i + 1] += sGridStart[i];
+    }
+
+    u32 total = sGridStart[LE_GRID_CELLS];
+    if (total > sGridLightsCapacity) {
+        u8* grid = realloc(sGridLights, total);
+        if (grid == NULL) {
+            LOG_ERROR("Failed to allocate the lighting engine grid");
+            sLightsPackedCount = 0;
+            memset(sGridStart, 0, sizeof(sGridStart));
+            return;
+        }
+        sGridLights = grid;
+        sGridLightsCapacity = total;
+    }
+
+    // fill the cells, keeping the lights in order
+    static u32 sGridFill[LE_GRID_CELLS];
+    memcpy(sGridFill, sGridStart, sizeof(sGridFill));
+    for (s32 i = 0; i < sLightsPackedCount; i++) {
+        s32 min[3], max[3];
+        le_light_grid_range(&sLightsPacked[i], min, max);
+        for (s32 z = min[2]; z <= max[2]; z++) {
+            for (s32 y = min[1]; y <= max[1]; y++) {
+                for (s32 x = min[0]; x <= max[0]; x++) {
+                    sGridLights[sGridFill[le_grid_cell(x, y, z)]++] = (u8) i;
+                }
+            }
+        }
+    }
+}
+
+// Returns the lights that may reach a position, as indices into sLightsPacked
+static inline u8* le_get_cell_lights(f32 x, f32 y, f32 z, u32* count) {
+    if (sLightsDirty) { le_rebuild_lights(); }
+    s32 cell = le_grid_cell(le_grid_coord(x), le_grid_coord(y), le_grid_coord(z));
+    *count = sGridStart[cell + 1] - sGridStart[cell];
+    return (*count > 0) ? &sGridLights[sGridStart[cell]] : NULL;
+}
+
 void le_calculate_vertex_lighting(Vtx_t* v, Color out) {
     if (sLights == NULL) { return; }
 
@@ -30,12 +138,15 @@ void le_calculate_vertex_lighting(Vtx_t* v, Color out) {
     f32 b = 0;
 #endif
     f32 weight = 1.0f;
-    for (struct LELight* light = hmap_begin(sLights); light != NULL; light = hmap_next(sLights)) {
+    u32 count = 0;
+    u8* cellLights = le_get_cell_lights(v->ob[0], v->ob[1], v->ob[2], &count);
+    for (u32 i = 0; i < count; i++) {
+        struct LELight* light = &sLightsPacked[cellLights[i]];
         f32 diffX = light->posX - v->ob[0];
         f32 diffY = light->posY - v->ob[1];
         f32 diffZ = light->posZ - v->ob[2];
         f32 dist = (diffX * diffX) + (diffY * diffY) + (diffZ * diffZ);
-        f32 radius = light->radius * light->radius;
+        f32 radius = sLightsRadiusSq[cellLights[i]];
         if (dist > radius) { continue; }
 
         f32 brightness = (1 - (dist / radius)) * light->intensity;
@@ -69,12 +180,15 @@ void le_calculate_lighting_color(Vec3f pos, Color out, f32 lightIntensityScalar)
     f32 b = 0;
 #endif
     f32 weight = 1.0f;
-    for (struct LELight* light = hmap_begin(sLights); light != NULL; light = hmap_next(sLights)) {
+    u32 count = 0;
+    u8* cellLights = le_get_cell_lights(pos[0], pos[1], pos[2], &count);
+    for (u32 i = 0; i < count; i++) {
+        struct LELight* light = &sLightsPacked[cellLights[i]];
         f32 diffX = light->posX - pos[0];
         f32 diffY = light->posY - pos[1];
         f32 diffZ = light->posZ - pos[2];
         f32 dist = (diffX * diffX) + (diffY * diffY) + (diffZ * diffZ);
-        f32 radius = light->radius * light->radius;
+        f32 radius = sLightsRadiusSq[cellLights[i]];
         if (dist > radius) { continue; }
 
         f32 brightness = (1 - (dist / radius)) * light->intensity * lightIntensityScalar;
@@ -100,12 +214,15 @@ void le_calculate_lighting_dir(Vec3f pos, Vec3f out) {
 
     Vec3f lightingDir = { 0, 0, 0 };
     s32 count = 1;
-    for (struct LELight* light = hmap_begin(sLights); light != NULL; light = hmap_next(sLights)) {
+    u32 cellCount = 0;
+    u8* cellLights = le_get_cell_lights(pos[0], pos[1], pos[2], &cellCount);
+    for (u32 i = 0; i < cellCount; i++) {
+        struct LELight* light = &sLightsPacked[cellLights[i]];
         f32 diffX = light->posX - pos[0];
         f32 diffY = light->posY - pos[1];
         f32 diffZ = light->posZ - pos[2];
         f32 dist = (diffX * diffX) + (diffY * diffY) + (diffZ * diffZ);
-        f32 radius = light->radius * light->radius;
+        f32 radius = sLightsRadiusSq[cellLights[i]];
         if (dist > radius) { continue; }
 
         Vec3f dir = {
@@ -146,6 +263,7 @@ s32 le_add_light(f32 x, f32 y, f32 z, u8 r, u8 g, u8 b, f32 radius, f32 intensit
     light->radius = radius;
     light->intensity = intensity;
     hmap_put(sLights, ++sLightID, light);
+    sLightsDirty = true;
     return sLightID;
 }
 
@@ -154,6 +272,7 @@ void le_remove_light(s32 id) {
 
     free(hmap_get(sLights, id));
     hmap_del(sLights, id);
+    sLightsDirty = true;
 }
 
 s32 le_get_light_count(void) {
@@ -173,6 +292,7 @@ void le_set_light_pos(s32 id, f32 x, f32 y, f32 z) {
     light->posX = x;
     light->posY = y;
     light->posZ = z;
+    sLightsDirty = true;
 }
 
 void le_set_light_color(s32 id, u8 r, u8 g, u8 b) {
@@ -183,6 +303,7 @@ void le_set_light_color(s32 id, u8 r, u8 g, u8 b) {
     light->colorR = r;
     light->colorG = g;
     light->colorB = b;
+    sLightsDirty = true;
 }
 
 void le_set_light_radius(s32 id, f32 radius) {
@@ -191,6 +312,7 @@ void le_set_light_radius(s32 id, f32 radius) {
     struct LELight* light = hmap_get(sLights, id);
     if (light == NULL) { return; }
     light->radius = radius;
+    sLightsDirty = true;
 }
 
 void le_set_light_intensity(s32 id, f32 intensity) {
@@ -199,6 +321,7 @@ void le_set_light_intensity(s32 id, f32 intensity) {
     struct LELight* light = hmap_get(sLights, id);
     if (light == NULL) { return; }
     light->intensity = intensity;
+    sLightsDirty = true;
 }
 
 void le_clear(void) {
@@ -208,6 +331,7 @@ void le_clear(void) {
         free(light);
     }
     hmap_clear(sLights);
+    sLightsDirty = true;
     sLightID = 0;
     sAmbientColor[0] = 0;
     sAmbientColor[1] = 0;
@@ -220,4 +344,8 @@ void le_shutdown(void) {
     le_clear();
     hmap_destroy(sLights);
     sLights = NULL;
+
+    free(sGridLights);
+    sGridLights = NULL;
+    sGridLightsCapacity = 0;
 }
@@ -1,3 +1,4 @@
+#include <stdlib.h>
 #include <PR/ultratypes.h>
 
 #include "prevent_bss_reordering.h"
@@ -18,6 +19,7 @@
 #include "engine/math_util.h"
 #include "game/level_update.h"
 #include "game/hardcoded.h"
+#include "game/area.h"
 #include "pc/network/network.h"
 #include "pc/lua/smlua_hooks.h"
 
@@ -34,6 +36,47 @@ SpatialPartitionCell gDynamicSurfacePartition[NUM_CELLS][NUM_CELLS];
 static struct GrowingArray *sSurfaceNodePool = NULL;
 static struct GrowingArray *sSurfacePool = NULL;
 
+/**
+ * The surfaces an object's collision model was last turned into, by object pool index.
+ * Surfaces only depend on the collision data, the object's scaled transform and its room,
+ * so objects that haven't moved copy them instead of transforming their vertices again.
+ * They're still added to the partition every frame, in the same order as before.
+ * A copy of the collision data is kept too, since it can be changed or reallocated in place.
+ */
+struct ObjectSurfaceCache {
+    s16 *collisionData;
+    s16 *collisionCopy;
+    u32 collisionLength;
+    u32 collisionCapacity;
+    Mat4 transform;
+    s8 room;
+    u32 numSurfaces;
+    u32 capacity;
+    struct Surface *surfaces;
+};
+static struct ObjectSurfaceCache sObjectSurfaceCache[OBJECT_POOL_CAPACITY] = { 0 };
+
+/**
+ * The static surfaces and partition lists an area's terrain was last turned into, by area index.
+ * Re-entering an area of the same level copies them back instead of reading the surfaces
+ * and sorting them into the partition again. Nodes are kept in list order, as surface indices.
+ */
+#define NUM_PARTITION_LISTS (NUM_CELLS * NUM_CELLS * 3)
+
+struct AreaTerrainCache {
+    s16 *terrainData;
+    s8 *surfaceRooms;
+    u8 fixCollisionBugs;
+    u32 numSurfaces;
+    u32 surfaceCapacity;
+    struct Surface *surfaces;
+    u32 numNodes;
+    u32 nodeCapacity;
+    u32 *nodeSurfaces;
+    u32 *listEnds;
+};
+static struct AreaTerrainCache sAreaTerrainCache[MAX_AREAS] = { 0 };
+
 /**
  * Allocate the part of the surface node pool to contain a surface node.
  */
@@ -413,6 +456,18 @@ static void load_static_surfaces(s16 **data, s16 *vertexData, s16 surfaceType, s
     }
 }
 
+/**
+ * Skip the surfaces of a surface type, advancing the rooms like load_static_surfaces() does.
+ */
+static void skip_static_surfaces(s16 **data, s16 surfaceType, s8 **surfaceRooms) {
+    s32 numSurfaces = *(*data);
+    *data += 1 + (3 + surface_has_force(surfaceType)) * numSurfaces;
+
+    if (*surfaceRooms != NULL) {
+        *surfaceRooms += numSurfaces;
+    }
+}
+
 /**
  * Read the data for vertices for reference by triangles.
  */
@@ -480,6 +535,14 @@ void alloc_surface_pools(void) {
 
     gCCMEnteredSlide = 0;
     reset_red_coins_collected();
+
+    // collision data can be freed along with the level, forget what was built from it
+    for (s32 i = 0; i < OBJECT_POOL_CAPACITY; i++) {
+        sObjectSurfaceCache[i].collisionData = NULL;
+    }
+    for (s32 i = 0; i < MAX_AREAS; i++) {
+        sAreaTerrainCache[i].terrainData = NULL;
+    }
 }
 
 /**
@@ -530,6 +593,122 @@ u32 get_area_terrain_size(s16 *terrainData) {
 }
 
 
+struct SurfaceIndex {
+    struct Surface *surface;
+    u32 index;
+};
+
+static int surface_index_compare(const void *a, const void *b) {
+    uintptr_t surfaceA = (uintptr_t) ((const struct SurfaceIndex *) a)->surface;
+    uintptr_t surfaceB = (uintptr_t) ((const struct SurfaceIndex *) b)->surface;
+    return (surfaceA > surfaceB) - (surfaceA < surfaceB);
+}
+
+/**
+ * Returns the cache of an area if it was built from the same terrain.
+ */
+static struct AreaTerrainCache *get_area_terrain_cache(s16 index, s16 *terrainData, s8 *surfaceRooms) {
+    if (index < 0 || index >= MAX_AREAS) { return NULL; }
+    struct AreaTerrainCache *cache = &sAreaTerrainCache[index];
+
+    if (cache->terrainData != terrainData || cache->surfaceRooms != surfaceRooms) { return NULL; }
+
+    // the partition lists are sorted differently with the collision fixes
+    if (cache->fixCollisionBugs != (gLevelValues.fixCollisionBugs != 0)) { return NULL; }
+    return cache;
+}
+
+/**
+ * Remember the static surfaces and partition lists that were just loaded for an area.
+ */
+static void store_area_terrain_cache(s16 index, s16 *terrainData, s8 *surfaceRooms) {
+    if (index < 0 || index >= MAX_AREAS) { return; }
+    struct AreaTerrainCache *cache = &sAreaTerrainCache[index];
+    cache->terrainData = NULL;
+
+    u32 numSurfaces = gSurfacesAllocated;
+    u32 numNodes = gSurfaceNodesAllocated;
+
+    // only the terrain's own surfaces can be copied back
+    for (u32 i = 0; i < numSurfaces; i++) {
+        if (((struct Surface *) sSurfacePool->buffer[i])->object != NULL) { return; }
+    }
+
+    if (cache->listEnds == NULL) {
+        cache->listEnds = malloc(NUM_PARTITION_LISTS * sizeof(u32));
+        if (cache->listEnds == NULL) { return; }
+    }
+    if (numSurfaces > cache->surfaceCapacity) {
+        struct Surface *surfaces = realloc(cache->surfaces, numSurfaces * sizeof(struct Surface));
+        if (surfaces == NULL) { return; }
+        cache->surfaces = surfaces;
+        cache->surfaceCapacity = numSurfaces;
+    }
+    if (numNodes > cache->nodeCapacity) {
+        u32 *nodeSurfaces = realloc(cache->nodeSurfaces, numNodes * sizeof(u32));
+        if (nodeSurfaces == NULL) { return; }
+        cache->nodeSurfaces = nodeSurfaces;
+        cache->nodeCapacity = numNodes;
+    }
+
+    struct SurfaceIndex *surfaceIndices = malloc((numSurfaces + 1) * sizeof(struct SurfaceIndex));
+    if (surfaceIndices == NULL) { return; }
+
+    for (u32 i = 0; i < numSurfaces; i++) {
+        cache->surfaces[i] = *(struct Surface *) sSurfacePool->buffer[i];
+        surfaceIndices[i].surface = sSurfacePool->buffer[i];
+        surfaceIndices[i].index = i;
+    }
+    qsort(surfaceIndices, numSurfaces, sizeof(struct SurfaceIndex), surface_index_compare);
+
+    SpatialPartitionCell *cells = &gStaticSurfacePartition[0][0];
+    u32 numListNodes = 0;
+    for (u32 i = 0; i < NUM_PARTITION_LISTS; i++) {
+        for (struct SurfaceNode *node = cells[i / 3][i % 3].next; node != NULL; node = node->next) {
+            struct SurfaceIndex key = { .surface = node->surface };
+            struct SurfaceIndex *found = bsearch(&key, surfaceIndices, numSurfaces, sizeof(struct SurfaceIndex), surface_index_compare);
+            if (found == NULL || numListNodes >= numNodes) {
+                free(surfaceIndices);
+                return;
+            }
+            cache->nodeSurfaces[numListNodes++] = found->index;
+        }
+        cache->listEnds[i] = numListNodes;
+    }
+    free(surfaceIndices);
+
+    cache->terrainData = terrainData;
+    cache->surfaceRooms = surfaceRooms;
+    cache->fixCollisionBugs = (gLevelValues.fixCollisionBugs != 0);
+    cache->numSurfaces = numSurfaces;
+    cache->numNodes = numListNodes;
+}
+
+/**
+ * Copy an area's static surfaces back and rebuild its partition lists in the same order.
+ */
+static void load_area_terrain_cache(struct AreaTerrainCache *cache) {
+    for (u32 i = 0; i < cache->numSurfaces; i++) {
+        struct Surface *surface = alloc_surface();
+        if (surface == NULL) { return; }
+        *surface = cache->surfaces[i];
+        surface->modifiedTimestamp = gGlobalTimer;
+    }
+
+    SpatialPartitionCell *cells = &gStaticSurfacePartition[0][0];
+    u32 node = 0;
+    for (u32 i = 0; i < NUM_PARTITION_LISTS; i++) {
+        struct SurfaceNode *list = &cells[i / 3][i % 3];
+        for (; node < cache->listEnds[i]; node++) {
+            struct SurfaceNode *newNode = alloc_surface_node();
+            if (newNode == NULL) { return; }
+            newNode->surface = sSurfacePool->buffer[cache->nodeSurfaces[node]];
+            list->next = newNode;
+            list = newNode;
+        }
+    }
+}
+
 /**
  * Process the level file, loading in vertices, surfaces, some objects, and environmental
  * boxes (water, gas, JRB fog).
@@ -537,6 +716,8 @@ u32 get_area_terrain_size(s16 *terrainData) {
 void load_area_terrain(s16 index, s16 *data, s8 *surfaceRooms, s16 *macroObjects) {
     s16 terrainLoadType = 0;
     s16 *vertexData = NULL;
+    s16 *terrainData = data;
+    s8 *terrainRooms = surfaceRooms;
 
     // Initialize the data for this.
     gEnvironmentRegions = NULL;
@@ -545,6 +726,12 @@ void load_area_terrain(s16 index, s16 *data, s8 *surfaceRooms, s16 *macroObjects
 
     clear_static_surfaces();
 
+    // Re-entering an area, its surfaces were already built
+    struct AreaTerrainCache *cache = get_area_terrain_cache(index, terrainData, terrainRooms);
+    if (cache != NULL) {
+        load_area_terrain_cache(cache);
+    }
+
     // A while loop iterating through each section of the level data. Sections of data
     // are prefixed by a terrain "type." This type is reused for surfaces as the surface
     // type.
@@ -553,7 +740,11 @@ void load_area_terrain(s16 index, s16 *data, s8 *surfaceRooms, s16 *macroObjects
         data++;
 
         if (TERRAIN_LOAD_IS_SURFACE_TYPE_LOW(terrainLoadType)) {
-            load_static_surfaces(&data, vertexData, terrainLoadType, &surfaceRooms);
+            if (cache != NULL) {
+                skip_static_surfaces(&data, terrainLoadType, &surfaceRooms);
+            } else {
+                load_static_surfaces(&data, vertexData, terrainLoadType, &surfaceRooms);
+            }
         } else if (terrainLoadType == TERRAIN_LOAD_VERTICES) {
             vertexData = read_vertex_data(&data);
         } else if (terrainLoadType == TERRAIN_LOAD_OBJECTS) {
@@ -565,11 +756,19 @@ void load_area_terrain(s16 index, s16 *data, s8 *surfaceRooms, s16 *macroObjects
         } else if (terrainLoadType == TERRAIN_LOAD_END) {
             break;
         } else if (TERRAIN_LOAD_IS_SURFACE_TYPE_HIGH(terrainLoadType)) {
-            load_static_surfaces(&data, vertexData, terrainLoadType, &surfaceRooms);
+            if (cache != NULL) {
+                skip_static_surfaces(&data, terrainLoadType, &surfaceRooms);
+            } else {
+                load_static_surfaces(&data, vertexData, terrainLoadType, &surfaceRooms);
+            }
             continue;
         }
     }
 
+    if (cache == NULL) {
+        store_area_terrain_cache(index, terrainData, terrainRooms);
+    }
+
     if (macroObjects != NULL && *macroObjects != -1) {
         // If the first macro object presetID is within the range [0, 29].
         // Generally an early spawning method, every object is in BBH (the first level).
@@ -604,6 +803,32 @@ void clear_dynamic_surfaces(void) {
     }
 }
 
+/**
+ * Gets the scaled transform that an object's collision vertices are moved by.
+ */
+static void get_object_collision_transform(Mat4 m) {
+    Mat4 *objectTransform = &gCurrentObject->transform;
+
+    if (gCurrentObject->header.gfx.throwMatrix == NULL) {
+        gCurrentObject->header.gfx.throwMatrix = objectTransform;
+        obj_build_transform_from_pos_and_angle(gCurrentObject, O_POS_INDEX, O_FACE_ANGLE_INDEX);
+    }
+
+    obj_apply_scale_to_matrix(gCurrentObject, m, *objectTransform);
+}
+
+/**
+ * Gets the room that an object's surfaces are put in.
+ */
+static s8 get_object_collision_room(void) {
+    // The DDD warp is initially loaded at the origin and moved to the proper
+    // position in paintings.c and doesn't update its room, so set it here.
+    if (gCurrentObject->behavior == segmented_to_virtual(smlua_override_behavior(bhvDddWarp))) {
+        return 5;
+    }
+    return 0;
+}
+
 /**
  * Applies an object's transformation to the object's vertices.
  */
@@ -613,22 +838,14 @@ void transform_object_vertices(s16 **data, s16 *vertexData) {
     register f32 vx, vy, vz;
     register s32 numVertices;
 
-    Mat4 *objectTransform;
     Mat4 m;
 
-    objectTransform = &gCurrentObject->transform;
-
     numVertices = *(*data);
     (*data)++;
 
     vertices = *data;
 
-    if (gCurrentObject->header.gfx.throwMatrix == NULL) {
-        gCurrentObject->header.gfx.throwMatrix = objectTransform;
-        obj_build_transform_from_pos_and_angle(gCurrentObject, O_POS_INDEX, O_FACE_ANGLE_INDEX);
-    }
-
-    obj_apply_scale_to_matrix(gCurrentObject, m, *objectTransform);
+    get_object_collision_transform(m);
 
     // Go through all vertices, rotating and translating them to transform the object.
     while (numVertices--) {
@@ -668,13 +885,7 @@ void load_object_surfaces(s16** data, s16* vertexData) {
     flags = surf_has_no_cam_collision(surfaceType) ? SURFACE_FLAG_NO_CAM_COLLISION : 0;
     flags |= SURFACE_FLAG_DYNAMIC;
 
-    // The DDD warp is initially loaded at the origin and moved to the proper
-    // position in paintings.c and doesn't update its room, so set it here.
-    if (gCurrentObject->behavior == segmented_to_virtual(smlua_override_behavior(bhvDddWarp))) {
-        room = 5;
-    } else {
-        room = 0;
-    }
+    room = get_object_collision_room();
 
     for (i = 0; i < numSurfaces; i++) {
         struct Surface* surface = read_surface_data(vertexData, data);
@@ -711,6 +922,77 @@ void load_object_surfaces(s16** data, s16* vertexData) {
     }
 }
 
+/**
+ * Adds the surfaces the object was turned into last time, if its collision hasn't changed since.
+ */
+static bool load_object_cached_surfaces(struct ObjectSurfaceCache *cache, Mat4 m, s8 room) {
+    if (cache->collisionData != gCurrentObject->collisionData) { return false; }
+    if (cache->room != room) { return false; }
+    if (memcmp(cache->transform, m, sizeof(Mat4)) != 0) { return false; }
+
+    // Compared one value at a time, the data is only read as far as it matches what was cached
+    for (u32 i = 0; i < cache->collisionLength; i++) {
+        if (cache->collisionCopy[i] != gCurrentObject->collisionData[i]) { return false; }
+    }
+
+    for (u32 i = 0; i < cache->numSurfaces; i++) {
+        struct Surface *surface = alloc_surface();
+        if (surface == NULL) { return true; }
+
+        // The previous vertices come from the pool slot, like read_surface_data() does
+        Vec3s prevVertex1, prevVertex2, prevVertex3;
+        vec3s_copy(prevVertex1, surface->vertex1);
+        vec3s_copy(prevVertex2, surface->vertex2);
+        vec3s_copy(prevVertex3, surface->vertex3);
+
+        *surface = cache->surfaces[i];
+        vec3s_copy(surface->prevVertex1, prevVertex1);
+        vec3s_copy(surface->prevVertex2, prevVertex2);
+        vec3s_copy(surface->prevVertex3, prevVertex3);
+        surface->modifiedTimestamp = gGlobalTimer;
+
+        if (gCurrentObject->firstSurface == 0) {
+            gCurrentObject->firstSurface = gSurfacesAllocated - 1;
+        }
+        gCurrentObject->numSurfaces++;
+
+        add_surface(surface, TRUE);
+    }
+    return true;
+}
+
+/**
+ * Remembers the surfaces that were just loaded for the object.
+ */
+static void cache_object_surfaces(struct ObjectSurfaceCache *cache, Mat4 m, s8 room, u32 firstSurface, u32 collisionLength) {
+    u32 numSurfaces = gSurfacesAllocated - firstSurface;
+    cache->collisionData = NULL;
+
+    if (collisionLength > cache->collisionCapacity) {
+        s16 *collisionCopy = realloc(cache->collisionCopy, collisionLength * sizeof(s16));
+        if (collisionCopy == NULL) { return; }
+        cache->collisionCopy = collisionCopy;
+        cache->collisionCapacity = collisionLength;
+    }
+
+    if (numSurfaces > cache->capacity) {
+        struct Surface *surfaces = realloc(cache->surfaces, numSurfaces * sizeof(struct Surface));
+        if (surfaces == NULL) { return; }
+        cache->surfaces = surfaces;
+        cache->capacity = numSurfaces;
+    }
+
+    for (u32 i = 0; i < numSurfaces; i++) {
+        cache->surfaces[i] = *(struct Surface *)sSurfacePool->buffer[firstSurface + i];
+    }
+    cache->numSurfaces = numSurfaces;
+    memcpy(cache->collisionCopy, gCurrentObject->collisionData, collisionLength * sizeof(s16));
+    cache->collisionLength = collisionLength;
+    cache->collisionData = gCurrentObject->collisionData;
+    cache->room = room;
+    memcpy(cache->transform, m, sizeof(Mat4));
+}
+
 /**
  * Transform an object's vertices, reload them, and render the object.
  */
@@ -762,12 +1044,31 @@ void load_object_collision_model(void) {
     if (!(gTimeStopState & TIME_STOP_ACTIVE)
         && (anyPlayerInTangibleRange)
         && !(gCurrentObject->activeFlags & ACTIVE_FLAG_IN_DIFFERENT_ROOM)) {
-        collisionData++;
-        transform_object_vertices(&collisionData, sVertexData);
+        struct ObjectSurfaceCache *cache = NULL;
+        s32 poolIndex = gCurrentObject - gObjectPool;
+        if (poolIndex >= 0 && poolIndex < OBJECT_POOL_CAPACITY) {
+            cache = &sObjectSurfaceCache[poolIndex];
+        }
+
+        Mat4 m;
+        get_object_collision_transform(m);
+        s8 room = get_object_collision_room();
+
+        if (cache == NULL || !load_object_cached_surfaces(cache, m, room)) {
+            u32 firstSurface = gSurfacesAllocated;
+
+            collisionData++;
+            transform_object_vertices(&collisionData, sVertexData);
 
-        // TERRAIN_LOAD_CONTINUE acts as an "end" to the terrain data.
-        while (*collisionData != TERRAIN_LOAD_CONTINUE) {
-            load_object_surfaces(&collisionData, sVertexData);
+            // TERRAIN_LOAD_CONTINUE acts as an "end" to the terrain data.
+            while (*collisionData != TERRAIN_LOAD_CONTINUE) {
+                load_object_surfaces(&collisionData, sVertexData);
+            }
+
+            if (cache != NULL) {
+                u32 collisionLength = (collisionData - gCurrentObject->collisionData) + 1;
+                cache_object_surfaces(cache, m, room, firstSurface, collisionLength);
+            }
         }
     }
 
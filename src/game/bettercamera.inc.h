@@ -438,7 +438,7 @@ static void newcam_collision(void) {
                 offset[1],
                 offset[2] * 1.2f,
             };
-            find_surface_on_ray(gNewCamera.posTarget, move, &surf, hitpos, 3.f);
+            camera_find_surface_on_ray(gNewCamera.posTarget, move, &surf, hitpos, 3.f);
             vec3f_copy(offset, hitpos);
             vec3f_sub(offset, gNewCamera.posTarget);
             if (surf) {
@@ -461,7 +461,7 @@ static void newcam_collision(void) {
 
         struct Surface *surf = NULL;
         Vec3f hitpos;
-        find_surface_on_ray(camorig, camray, &surf, hitpos, 3.f);
+        camera_find_surface_on_ray(camorig, camray, &surf, hitpos, 3.f);
         if (surf == NULL) {
             allhit = false;
         }
@@ -476,7 +476,7 @@ static void newcam_collision(void) {
     if (allhit) {
         struct Surface *surf = NULL;
         Vec3f hitpos;
-        find_surface_on_ray(gNewCamera.lookAt, camdir, &surf, hitpos, 3.f);
+        camera_find_surface_on_ray(gNewCamera.lookAt, camdir, &surf, hitpos, 3.f);
 
         if (surf) {
             // offset the hit pos by the hit normal
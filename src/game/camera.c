@@ -14,6 +14,7 @@
 #include "engine/math_util.h"
 #include "area.h"
 #include "engine/surface_collision.h"
+#include "camera_collision.h"
 #include "engine/behavior_script.h"
 #include "level_update.h"
 #include "ingame_menu.h"
@@ -807,7 +808,7 @@ void set_camera_height(struct Camera *c, f32 goalHeight) {
     UNUSED u8 filler[8];
     UNUSED s16 action = sMarioCamState->action;
     f32 baseOff = 125.f;
-    f32 camCeilHeight = find_ceil(c->pos[0], gLakituState.goalPos[1] - 50.f, c->pos[2], &surface);
+    f32 camCeilHeight = camera_find_ceil(c->pos[0], gLakituState.goalPos[1] - 50.f, c->pos[2], &surface);
 
     if (sMarioCamState->action & ACT_FLAG_HANGING) {
         marioCeilHeight = sMarioGeometry.currCeilHeight;
@@ -825,7 +826,7 @@ void set_camera_height(struct Camera *c, f32 goalHeight) {
 
         approach_camera_height(c, goalHeight, 5.f);
     } else {
-        camFloorHeight = find_floor(c->pos[0], c->pos[1] + 100.f, c->pos[2], &surface) + baseOff;
+        camFloorHeight = camera_find_floor(c->pos[0], c->pos[1] + 100.f, c->pos[2], &surface) + baseOff;
         marioFloorHeight = baseOff + sMarioGeometry.currFloorHeight;
 
         if (camFloorHeight < marioFloorHeight) {
@@ -867,7 +868,7 @@ s16 look_down_slopes(s16 camYaw) {
     f32 xOff = sMarioCamState->pos[0] + sins(camYaw) * 40.f;
     f32 zOff = sMarioCamState->pos[2] + coss(camYaw) * 40.f;
 
-    floorDY = find_floor(xOff, sMarioCamState->pos[1], zOff, &floor) - sMarioCamState->pos[1];
+    floorDY = camera_find_floor(xOff, sMarioCamState->pos[1], zOff, &floor) - sMarioCamState->pos[1];
 
     if (floor != NULL) {
         if (floor->type != SURFACE_WALL_MISC && floorDY > 0) {
@@ -1563,7 +1564,7 @@ s32 update_fixed_camera(struct Camera *c, Vec3f focus, UNUSED Vec3f pos) {
         goalHeight += 300 - distCamToFocus;
     }
 
-    ceilHeight = find_ceil(c->pos[0], goalHeight - 100.f, c->pos[2], &ceiling);
+    ceilHeight = camera_find_ceil(c->pos[0], goalHeight - 100.f, c->pos[2], &ceiling);
     if (ceilHeight != gLevelValues.cellHeightLimit) {
         if (goalHeight > (ceilHeight -= 125.f)) {
             goalHeight = ceilHeight;
@@ -1664,7 +1665,7 @@ s32 update_boss_fight_camera(struct Camera *c, Vec3f focus, Vec3f pos) {
     // When C-Down is not active, this
     vec3f_set_dist_and_angle(focus, pos, focusDistance, 0x1000, yaw);
     // Find the floor of the arena
-    pos[1] = find_floor(c->areaCenX, gLevelValues.cellHeightLimit, c->areaCenZ, &floor);
+    pos[1] = camera_find_floor(c->areaCenX, gLevelValues.cellHeightLimit, c->areaCenZ, &floor);
     if (floor != NULL) {
         nx = floor->normal.x;
         ny = floor->normal.y;
@@ -1996,7 +1997,7 @@ s32 mode_behind_mario(struct Camera *c) {
 
     // Keep the camera above the water surface if swimming
     if (c->mode == CAMERA_MODE_WATER_SURFACE) {
-        floorHeight = find_floor(c->pos[0], c->pos[1], c->pos[2], &floor);
+        floorHeight = camera_find_floor(c->pos[0], c->pos[1], c->pos[2], &floor);
         newPos[1] = marioState->waterLevel + 120;
         if (newPos[1] < (floorHeight += 120.f)) {
             newPos[1] = floorHeight;
@@ -2088,7 +2089,7 @@ s16 update_slide_camera(struct Camera *c) {
         sStatusFlags |= CAM_FLAG_BLOCK_SMOOTH_MOVEMENT;
 
         // Stay above the slide floor
-        floorHeight = find_floor(c->pos[0], c->pos[1] + 200.f, c->pos[2], &floor) + 125.f;
+        floorHeight = camera_find_floor(c->pos[0], c->pos[1] + 200.f, c->pos[2], &floor) + 125.f;
         if (c->pos[1] < floorHeight) {
             c->pos[1] = floorHeight;
         }
@@ -2169,7 +2170,7 @@ s16 update_default_camera(struct Camera *c) {
     f32 scale;
     s32 avoidStatus = 0;
     s32 closeToMario = 0;
-    f32 ceilHeight = find_ceil(gLakituState.goalPos[0],
+    f32 ceilHeight = camera_find_ceil(gLakituState.goalPos[0],
                                gLakituState.goalPos[1],
                                gLakituState.goalPos[2], &ceil);
     s16 yawDir;
@@ -2334,10 +2335,10 @@ s16 update_default_camera(struct Camera *c) {
 
     marioFloorHeight = 125.f + sMarioGeometry.currFloorHeight;
     marioFloor = sMarioGeometry.currFloor;
-    camFloorHeight = find_floor(cPos[0], cPos[1] + 50.f, cPos[2], &cFloor) + 125.f;
+    camFloorHeight = camera_find_floor(cPos[0], cPos[1] + 50.f, cPos[2], &cFloor) + 125.f;
     for (scale = 0.1f; scale < 1.f; scale += 0.2f) {
         scale_along_line(tempPos, cPos, sMarioCamState->pos, scale);
-        tempFloorHeight = find_floor(tempPos[0], tempPos[1], tempPos[2], &tempFloor) + 125.f;
+        tempFloorHeight = camera_find_floor(tempPos[0], tempPos[1], tempPos[2], &tempFloor) + 125.f;
         if (tempFloor != NULL && tempFloorHeight > marioFloorHeight) {
             marioFloorHeight = tempFloorHeight;
             marioFloor = tempFloor;
@@ -2547,7 +2548,7 @@ s32 update_spiral_stairs_camera(struct Camera *c, Vec3f focus, Vec3f pos) {
     checkPos[0] = focus[0] + (cPos[0] - focus[0]) * 0.7f;
     checkPos[1] = focus[1] + (cPos[1] - focus[1]) * 0.7f + 300.f;
     checkPos[2] = focus[2] + (cPos[2] - focus[2]) * 0.7f;
-    floorHeight = find_floor(checkPos[0], checkPos[1] + 50.f, checkPos[2], &floor);
+    floorHeight = camera_find_floor(checkPos[0], checkPos[1] + 50.f, checkPos[2], &floor);
 
     if (floorHeight != gLevelValues.floorLowerLimit) {
         if (floorHeight < sMarioGeometry.currFloorHeight) {
@@ -2682,11 +2683,11 @@ s32 exit_c_up(struct Camera *c) {
                         vec3f_set_dist_and_angle(checkFoc, curPos, d, 0, curYaw + checkYaw);
 
                         // Check if we're zooming out into a floor or ceiling
-                        ceilHeight = find_ceil(curPos[0], curPos[1] - 150.f, curPos[2], &surface) + -10.f;
+                        ceilHeight = camera_find_ceil(curPos[0], curPos[1] - 150.f, curPos[2], &surface) + -10.f;
                         if (surface != NULL && ceilHeight < curPos[1]) {
                             break;
                         }
-                        floorHeight = find_floor(curPos[0], curPos[1] + 150.f, curPos[2], &surface) + 10.f;
+                        floorHeight = camera_find_floor(curPos[0], curPos[1] + 150.f, curPos[2], &surface) + 10.f;
                         if (surface != NULL && floorHeight > curPos[1]) {
                             break;
                         }
@@ -3114,7 +3115,7 @@ void update_lakitu(struct Camera *c) {
 
         if (c->mode != CAMERA_MODE_C_UP && c->cutscene == 0 && c->mode != CAMERA_MODE_NEWCAM) {
             gCheckingSurfaceCollisionsForCamera = TRUE;
-            distToFloor = find_floor(gLakituState.pos[0],
+            distToFloor = camera_find_floor(gLakituState.pos[0],
                                      gLakituState.pos[1] + 20.0f,
                                      gLakituState.pos[2], &floor);
             gCheckingSurfaceCollisionsForCamera = FALSE;
@@ -3219,6 +3220,7 @@ void update_camera(struct Camera *c) {
     sMarioGeometry.prevFloorType = sMarioGeometry.currFloorType;
     sMarioGeometry.prevCeilType = sMarioGeometry.currCeilType;
 
+    camera_collision_begin();
     find_mario_floor_and_ceil(&sMarioGeometry);
     gCheckingSurfaceCollisionsForCamera = TRUE;
     vec3f_copy(c->pos, gLakituState.goalPos);
@@ -3404,6 +3406,8 @@ void update_camera(struct Camera *c) {
             c->paletteEditorCap = false;
         }
     }
+
+    camera_collision_end();
 }
 
 void soft_reset_camera(struct Camera* c) {
@@ -3651,7 +3655,7 @@ void init_camera(struct Camera *c) {
         // Set the camera pos to marioOffset (relative to Mario), added to Mario's position
         offset_rotated(c->pos, sMarioCamState->pos, marioOffset, sMarioCamState->faceAngle);
         if (c->mode != CAMERA_MODE_BEHIND_MARIO) {
-            c->pos[1] = find_floor(sMarioCamState->pos[0], sMarioCamState->pos[1] + 100.f,
+            c->pos[1] = camera_find_floor(sMarioCamState->pos[0], sMarioCamState->pos[1] + 100.f,
                                 sMarioCamState->pos[2], &floor) + 125.f;
         }
     }
@@ -4183,7 +4187,7 @@ s32 collide_with_walls(Vec3f pos, f32 offsetY, f32 radius) {
     collisionData.z = pos[2];
     collisionData.radius = radius;
     collisionData.offsetY = offsetY;
-    numCollisions = find_wall_collisions(&collisionData);
+    numCollisions = camera_find_wall_collisions(&collisionData);
     if (numCollisions != 0) {
         for (i = 0; i < collisionData.numWalls; i++) {
             wall = collisionData.walls[collisionData.numWalls - 1];
@@ -5725,7 +5729,7 @@ s16 next_lakitu_state(Vec3f newPos, Vec3f newFoc, Vec3f curPos, Vec3f curFoc,
         vec3f_copy(newPos, nextPos);
 
         if (gCamera->cutscene != 0 || !(gCameraMovementFlags & CAM_MOVE_C_UP_MODE)) {
-            floorHeight = find_floor(newPos[0], newPos[1], newPos[2], &floor);
+            floorHeight = camera_find_floor(newPos[0], newPos[1], newPos[2], &floor);
             if (floorHeight != gLevelValues.floorLowerLimit) {
                 if ((floorHeight += 125.f) > newPos[1]) {
                     newPos[1] = floorHeight;
@@ -6131,7 +6135,7 @@ BAD_RETURN(s32) cam_castle_lobby_entrance(UNUSED struct Camera *c) {
 BAD_RETURN(s32) cam_castle_look_upstairs(struct Camera *c) {
     if (!c) { return; }
     struct Surface *floor;
-    f32 floorHeight = find_floor(c->pos[0], c->pos[1], c->pos[2], &floor);
+    f32 floorHeight = camera_find_floor(c->pos[0], c->pos[1], c->pos[2], &floor);
 
     // If Mario is on the first few steps, fix the camera pos, making it look up
     if ((sMarioGeometry.currFloorHeight > 1229.f) && (floorHeight < 1229.f)
@@ -6146,7 +6150,7 @@ BAD_RETURN(s32) cam_castle_look_upstairs(struct Camera *c) {
 BAD_RETURN(s32) cam_castle_basement_look_downstairs(struct Camera *c) {
     if (!c) { return; }
     struct Surface *floor;
-    f32 floorHeight = find_floor(c->pos[0], c->pos[1], c->pos[2], &floor);
+    f32 floorHeight = camera_find_floor(c->pos[0], c->pos[1], c->pos[2], &floor);
 
     // Fix the camera pos, making it look downwards. Only active on the top few steps
     if ((floorHeight > -110.f) && (sCSideButtonYaw == 0)) {
@@ -7048,8 +7052,8 @@ void resolve_geometry_collisions(Vec3f pos, UNUSED Vec3f lastGood) {
     struct Surface *surf;
 
     f32_find_wall_collision(&pos[0], &pos[1], &pos[2], 0.f, 100.f);
-    floorY = find_floor(pos[0], pos[1] + 50.f, pos[2], &surf);
-    ceilY = find_ceil(pos[0], pos[1] - 50.f, pos[2], &surf);
+    floorY = camera_find_floor(pos[0], pos[1] + 50.f, pos[2], &surf);
+    ceilY = camera_find_ceil(pos[0], pos[1] - 50.f, pos[2], &surf);
 
     if ((gLevelValues.floorLowerLimit != floorY) && (gLevelValues.cellHeightLimit == ceilY)) {
         if (pos[1] < (floorY += 125.f)) {
@@ -7130,7 +7134,7 @@ s32 rotate_camera_around_walls(struct Camera *c, Vec3f cPos, s16 *avoidYaw, s16
         // Increase the coarse check radius
         camera_approach_f32_symmetric_bool(&coarseRadius, 250.f, 30.f);
 
-        if (find_wall_collisions(&colData) != 0) {
+        if (camera_find_wall_collisions(&colData) != 0) {
             wall = colData.walls[colData.numWalls - 1];
 
             // If we're over halfway from Mario to Lakitu, then there's a wall near the camera, but
@@ -7155,7 +7159,7 @@ s32 rotate_camera_around_walls(struct Camera *c, Vec3f cPos, s16 *avoidYaw, s16
             // Increase the fine check radius
             camera_approach_f32_symmetric_bool(&fineRadius, 200.f, 20.f);
 
-            if (find_wall_collisions(&colData) != 0) {
+            if (camera_find_wall_collisions(&colData) != 0) {
                 wall = colData.walls[colData.numWalls - 1];
                 horWallNorm = atan2s(wall->normal.z, wall->normal.x);
                 wallYaw = horWallNorm + DEGREES(90);
@@ -7192,23 +7196,23 @@ void find_mario_floor_and_ceil(struct PlayerGeometry *pg) {
     s16 tempCheckingSurfaceCollisionsForCamera = gCheckingSurfaceCollisionsForCamera;
     gCheckingSurfaceCollisionsForCamera = TRUE;
 
-    if (find_floor(sMarioCamState->pos[0], sMarioCamState->pos[1] + 10.f, sMarioCamState->pos[2], &surf) != gLevelValues.floorLowerLimit && surf != NULL) {
+    if (camera_find_floor(sMarioCamState->pos[0], sMarioCamState->pos[1] + 10.f, sMarioCamState->pos[2], &surf) != gLevelValues.floorLowerLimit && surf != NULL) {
         pg->currFloorType = surf->type;
     } else {
         pg->currFloorType = 0;
     }
 
-    if (find_ceil(sMarioCamState->pos[0], sMarioCamState->pos[1] - 10.f, sMarioCamState->pos[2], &surf) != gLevelValues.cellHeightLimit && surf != NULL) {
+    if (camera_find_ceil(sMarioCamState->pos[0], sMarioCamState->pos[1] - 10.f, sMarioCamState->pos[2], &surf) != gLevelValues.cellHeightLimit && surf != NULL) {
         pg->currCeilType = surf->type;
     } else {
         pg->currCeilType = 0;
     }
 
     gCheckingSurfaceCollisionsForCamera = FALSE;
-    pg->currFloorHeight = find_floor(sMarioCamState->pos[0],
+    pg->currFloorHeight = camera_find_floor(sMarioCamState->pos[0],
                                      sMarioCamState->pos[1] + 10.f,
                                      sMarioCamState->pos[2], &pg->currFloor);
-    pg->currCeilHeight = find_ceil(sMarioCamState->pos[0],
+    pg->currCeilHeight = camera_find_ceil(sMarioCamState->pos[0],
                                    sMarioCamState->pos[1] - 10.f,
                                    sMarioCamState->pos[2], &pg->currCeil);
     pg->waterHeight = find_water_level(sMarioCamState->pos[0], sMarioCamState->pos[2]);
@@ -9602,7 +9606,7 @@ BAD_RETURN(s32) cutscene_non_painting_set_cam_pos(struct Camera *c) {
 
     if (!dynos_level_is_vanilla_level(gCurrLevelNum)) {
         offset_rotated(c->pos, sCutsceneVars[7].point, sCutsceneVars[5].point, sCutsceneVars[7].angle);
-        f32 floorHeight = find_floor(c->pos[0], c->pos[1] + 1000.f, c->pos[2], &floor);
+        f32 floorHeight = camera_find_floor(c->pos[0], c->pos[1] + 1000.f, c->pos[2], &floor);
         c->pos[1] = ((floorHeight + 125) + c->pos[1]) / 2.0f;
     } else {
         switch (gPrevLevel) {
@@ -9624,7 +9628,7 @@ BAD_RETURN(s32) cutscene_non_painting_set_cam_pos(struct Camera *c) {
 
             default:
                 offset_rotated(c->pos, sCutsceneVars[7].point, sCutsceneVars[5].point, sCutsceneVars[7].angle);
-                c->pos[1] = find_floor(c->pos[0], c->pos[1] + 1000.f, c->pos[2], &floor) + 125.f;
+                c->pos[1] = camera_find_floor(c->pos[0], c->pos[1] + 1000.f, c->pos[2], &floor) + 125.f;
                 break;
         }
     }
@@ -10533,7 +10537,7 @@ BAD_RETURN(s32) cutscene_enter_painting(struct Camera *c) {
         approach_vec3f_asymptotic(c->focus, focus, 0.1f, 0.1f, 0.1f);
         focusOffset[2] = -(((gRipplingPainting->size * 1000.f) / 2) / 307.f);
         offset_rotated(focus, paintingPos, focusOffset, paintingAngle);
-        floorHeight = find_floor(focus[0], focus[1] + 500.f, focus[2], &highFloor) + 125.f;
+        floorHeight = camera_find_floor(focus[0], focus[1] + 500.f, focus[2], &highFloor) + 125.f;
 
         if (focus[1] < floorHeight) {
             focus[1] = floorHeight;
@@ -10545,7 +10549,7 @@ BAD_RETURN(s32) cutscene_enter_painting(struct Camera *c) {
             approach_vec3f_asymptotic(c->pos, focus, 0.9f, 0.9f, 0.9f);
         }
 
-        find_floor(sMarioCamState->pos[0], sMarioCamState->pos[1] + 50.f, sMarioCamState->pos[2], &floor);
+        camera_find_floor(sMarioCamState->pos[0], sMarioCamState->pos[1] + 50.f, sMarioCamState->pos[2], &floor);
 
         if (floor != NULL) {
             if ((floor->type < SURFACE_PAINTING_WOBBLE_A6) || (floor->type > SURFACE_PAINTING_WARP_F9)) {
@@ -10588,7 +10592,7 @@ BAD_RETURN(s32) cutscene_exit_painting_start(struct Camera *c) {
     sCutsceneVars[0].angle[2] = 0;
     offset_rotated(c->focus, sCutsceneVars[0].point, sCutsceneVars[1].point, sCutsceneVars[0].angle);
     offset_rotated(c->pos, sCutsceneVars[0].point, sCutsceneVars[2].point, sCutsceneVars[0].angle);
-    floorHeight = find_floor(c->pos[0], c->pos[1] + 10.f, c->pos[2], &floor);
+    floorHeight = camera_find_floor(c->pos[0], c->pos[1] + 10.f, c->pos[2], &floor);
 
     if (floorHeight != gLevelValues.floorLowerLimit) {
         if (c->pos[1] < (floorHeight += 60.f)) {
@@ -10626,7 +10630,7 @@ BAD_RETURN(s32) cutscene_exit_painting_move_to_floor(struct Camera *c) {
     Vec3f floorHeight;
 
     vec3f_copy(floorHeight, sMarioCamState->pos);
-    floorHeight[1] = find_floor(sMarioCamState->pos[0], sMarioCamState->pos[1] + 10.f, sMarioCamState->pos[2], &floor);
+    floorHeight[1] = camera_find_floor(sMarioCamState->pos[0], sMarioCamState->pos[1] + 10.f, sMarioCamState->pos[2], &floor);
 
     if (floor != NULL) {
         floorHeight[1] = floorHeight[1] + (sMarioCamState->pos[1] - floorHeight[1]) * 0.7f + 125.f;
@@ -10754,7 +10758,7 @@ BAD_RETURN(s32) cutscene_enter_cannon_raise(struct Camera *c) {
         offset_rotated(c->focus, c->focus, cannonFocus, cannonAngle);
     }
 
-    floorHeight = find_floor(c->pos[0], c->pos[1] + 500.f, c->pos[2], &floor) + 100.f;
+    floorHeight = camera_find_floor(c->pos[0], c->pos[1] + 500.f, c->pos[2], &floor) + 100.f;
 
     if (c->pos[1] < floorHeight) {
         c->pos[1] = floorHeight;
@@ -12227,7 +12231,7 @@ static u8 rom_hack_cam_can_see_mario(Vec3f desiredPos) {
         return true;
     }
 
-    f32 floorHeight = find_floor(desiredPos[0], desiredPos[1], desiredPos[2], &surf);
+    f32 floorHeight = camera_find_floor(desiredPos[0], desiredPos[1], desiredPos[2], &surf);
     if (surf == NULL || floorHeight <= gLevelValues.floorLowerLimit) {
         return false;
     }
@@ -12257,7 +12261,7 @@ static u8 rom_hack_cam_can_see_mario(Vec3f desiredPos) {
             camdir[2] = target[2] - desiredPos[2];
 
             Vec3f hitpos;
-            find_surface_on_ray(desiredPos, camdir, &surf, hitpos, 3.0f);
+            camera_find_surface_on_ray(desiredPos, camdir, &surf, hitpos, 3.0f);
             if (surf == NULL) {
                 return true;
             }
@@ -12276,7 +12280,7 @@ void rom_hack_cam_walk(Vec3f pos, Vec3f dir, f32 dist) {
 
     struct Surface* surf = NULL;
     Vec3f hitpos;
-    find_surface_on_ray(pos, movement, &surf, hitpos, 3.0f);
+    camera_find_surface_on_ray(pos, movement, &surf, hitpos, 3.0f);
 
     if (surf == NULL) {
         pos[0] += movement[0];
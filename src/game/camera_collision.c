@@ -0,0 +1,177 @@
+#include <string.h>
+
+#include "camera_collision.h"
+#include "object_list_processor.h"
+#include "pc/utils/misc.h"
+
+// Queries are found by hashing their truncated position with linear probing,
+// the same position is what find_floor() and find_ceil() look at.
+// The table is emptied by moving to the next generation instead of clearing it.
+#define CAMERA_QUERY_BUCKETS 256
+#define CAMERA_QUERY_MAX_USED_BUCKETS (CAMERA_QUERY_BUCKETS * 3 / 4)
+
+enum CameraQueryType {
+    CAMERA_QUERY_FLOOR = 1,
+    CAMERA_QUERY_CEIL,
+};
+
+struct CameraQuery {
+    u32 generation;
+    u8 type;
+    s16 x;
+    s16 y;
+    s16 z;
+    f32 height;
+    struct Surface *surface;
+};
+
+extern u8 gInterpolatingSurfaces;
+
+static struct CameraQuery sCameraQueries[CAMERA_QUERY_BUCKETS] = { 0 };
+static u32 sCameraQueryGeneration = 1;
+static u32 sCameraQueryUsedBuckets = 0;
+static bool sCameraQueriesActive = false;
+static s32 sCameraQuerySurfaces = 0;
+static s32 sCameraQuerySurfaceNodes = 0;
+
+static struct CameraCollisionStats sCameraCollisionStats = { 0 };
+static struct CameraCollisionStats sCameraCollisionLastStats = { 0 };
+
+static void camera_query_flush(void) {
+    sCameraQueryGeneration++;
+    sCameraQueryUsedBuckets = 0;
+    sCameraQuerySurfaces = gSurfacesAllocated;
+    sCameraQuerySurfaceNodes = gSurfaceNodesAllocated;
+}
+
+void camera_collision_begin(void) {
+    camera_query_flush();
+    sCameraQueriesActive = true;
+}
+
+void camera_collision_end(void) {
+    sCameraQueriesActive = false;
+    sCameraCollisionLastStats = sCameraCollisionStats;
+    memset(&sCameraCollisionStats, 0, sizeof(sCameraCollisionStats));
+}
+
+void camera_collision_get_stats(struct CameraCollisionStats *stats) {
+    *stats = sCameraCollisionLastStats;
+}
+
+static bool camera_query_memoizable(void) {
+    if (!sCameraQueriesActive) { return false; }
+
+    // Only camera queries are memoized, the others depend on the current object.
+    // Interpolated surfaces and intangible floors change the result of the same query.
+    if (!gCheckingSurfaceCollisionsForCamera) { return false; }
+    if (gInterpolatingSurfaces || gFindFloorIncludeSurfaceIntangible) { return false; }
+
+    // Surfaces were loaded or cleared since the queries were made
+    if (sCameraQuerySurfaces != gSurfacesAllocated || sCameraQuerySurfaceNodes != gSurfaceNodesAllocated) {
+        camera_query_flush();
+    }
+    return true;
+}
+
+static u32 camera_query_hash(u8 type, s16 x, s16 y, s16 z) {
+    u32 key = ((u32)(u16) x * 73856093u) ^ ((u32)(u16) y * 19349663u) ^ ((u32)(u16) z * 83492791u) ^ type;
+    return key & (CAMERA_QUERY_BUCKETS - 1);
+}
+
+static struct CameraQuery *camera_query_find(u8 type, f32 posX, f32 posY, f32 posZ, bool *found) {
+    s16 x = (s16) posX;
+    s16 y = (s16) posY;
+    s16 z = (s16) posZ;
+    u32 slot = camera_query_hash(type, x, y, z);
+    *found = false;
+
+    for (u32 i = 0; i < CAMERA_QUERY_BUCKETS; i++) {
+        struct CameraQuery *query = &sCameraQueries[slot];
+        if (query->generation != sCameraQueryGeneration) {
+            if (sCameraQueryUsedBuckets >= CAMERA_QUERY_MAX_USED_BUCKETS) { return NULL; }
+            sCameraQueryUsedBuckets++;
+            query->generation = sCameraQueryGeneration;
+            query->type = type;
+            query->x = x;
+            query->y = y;
+            query->z = z;
+            return query;
+        }
+        if (query->type == type && query->x == x && query->y == y && query->z == z) {
+            *found = true;
+            return query;
+        }
+        slot = (slot + 1) & (CAMERA_QUERY_BUCKETS - 1);
+    }
+    return NULL;
+}
+
+f32 camera_find_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor) {
+    sCameraCollisionStats.queries++;
+    f64 start = clock_elapsed_f64();
+
+    struct CameraQuery *query = NULL;
+    bool found = false;
+    if (camera_query_memoizable()) {
+        query = camera_query_find(CAMERA_QUERY_FLOOR, xPos, yPos, zPos, &found);
+    }
+
+    f32 height;
+    if (found) {
+        sCameraCollisionStats.memoHits++;
+        *pfloor = query->surface;
+        height = query->height;
+    } else {
+        height = find_floor(xPos, yPos, zPos, pfloor);
+        if (query != NULL) {
+            query->surface = *pfloor;
+            query->height = height;
+        }
+    }
+
+    sCameraCollisionStats.time += clock_elapsed_f64() - start;
+    return height;
+}
+
+f32 camera_find_ceil(f32 posX, f32 posY, f32 posZ, struct Surface **pceil) {
+    sCameraCollisionStats.queries++;
+    f64 start = clock_elapsed_f64();
+
+    struct CameraQuery *query = NULL;
+    bool found = false;
+    if (camera_query_memoizable()) {
+        query = camera_query_find(CAMERA_QUERY_CEIL, posX, posY, posZ, &found);
+    }
+
+    f32 height;
+    if (found) {
+        sCameraCollisionStats.memoHits++;
+        *pceil = query->surface;
+        height = query->height;
+    } else {
+        height = find_ceil(posX, posY, posZ, pceil);
+        if (query != NULL) {
+            query->surface = *pceil;
+            query->height = height;
+        }
+    }
+
+    sCameraCollisionStats.time += clock_elapsed_f64() - start;
+    return height;
+}
+
+s32 camera_find_wall_collisions(struct WallCollisionData *colData) {
+    sCameraCollisionStats.queries++;
+    f64 start = clock_elapsed_f64();
+    s32 numCollisions = find_wall_collisions(colData);
+    sCameraCollisionStats.time += clock_elapsed_f64() - start;
+    return numCollisions;
+}
+
+void camera_find_surface_on_ray(Vec3f orig, Vec3f dir, struct Surface **hit_surface, Vec3f hit_pos, f32 precision) {
+    sCameraCollisionStats.queries++;
+    f64 start = clock_elapsed_f64();
+    find_surface_on_ray(orig, dir, hit_surface, hit_pos, precision);
+    sCameraCollisionStats.time += clock_elapsed_f64() - start;
+}
@@ -0,0 +1,26 @@
+#ifndef CAMERA_COLLISION_H
+#define CAMERA_COLLISION_H
+
+#include "types.h"
+#include "engine/surface_collision.h"
+
+// Collision queries made by the camera. Between camera_collision_begin() and camera_collision_end()
+// (one camera update), identical floor and ceiling queries made for the camera are only run once.
+// Surfaces don't change during a camera update, so the memoized results are exact.
+
+struct CameraCollisionStats {
+    u32 queries;
+    u32 memoHits;
+    f64 time;
+};
+
+void camera_collision_begin(void);
+void camera_collision_end(void);
+void camera_collision_get_stats(struct CameraCollisionStats *stats);
+
+f32 camera_find_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor);
+f32 camera_find_ceil(f32 posX, f32 posY, f32 posZ, struct Surface **pceil);
+s32 camera_find_wall_collisions(struct WallCollisionData *colData);
+void camera_find_surface_on_ray(Vec3f orig, Vec3f dir, struct Surface **hit_surface, Vec3f hit_pos, f32 precision);
+
+#endif // CAMERA_COLLISION_H
@@ -0,0 +1,156 @@
+#include <string.h>
+
+#include "object_behavior_index.h"
+#include "object_list_processor.h"
+
+// Buckets are found by hashing the behavior pointer with linear probing.
+// Buckets aren't removed when they become empty, they're dropped when the table is compacted.
+#define BEHAVIOR_INDEX_BUCKETS 4096
+#define BEHAVIOR_INDEX_MAX_USED_BUCKETS (BEHAVIOR_INDEX_BUCKETS * 3 / 4)
+#define BEHAVIOR_INDEX_NONE -1
+
+struct BehaviorIndexBucket {
+    const BehaviorScript *behavior;
+    s16 head;
+    s16 tail;
+    s16 count;
+};
+
+static struct BehaviorIndexBucket sBehaviorIndexBuckets[BEHAVIOR_INDEX_BUCKETS] = { 0 };
+static u32 sBehaviorIndexUsedBuckets = 0;
+static bool sBehaviorIndexInitialized = false;
+
+// Links are stored by object pool index
+static s16 sBehaviorIndexNext[OBJECT_POOL_CAPACITY] = { 0 };
+static s16 sBehaviorIndexPrev[OBJECT_POOL_CAPACITY] = { 0 };
+static s16 sBehaviorIndexBucketOf[OBJECT_POOL_CAPACITY] = { 0 };
+
+static s32 behavior_index_pool_index(struct Object *obj) {
+    if (obj < gObjectPool || obj >= gObjectPool + OBJECT_POOL_CAPACITY) { return BEHAVIOR_INDEX_NONE; }
+    if (!sBehaviorIndexInitialized) { obj_behavior_index_clear(); }
+    return (s32)(obj - gObjectPool);
+}
+
+static u32 behavior_index_hash(const BehaviorScript *behavior) {
+    uintptr_t key = (uintptr_t)behavior >> 2;
+    return (u32)(key * 2654435761u) & (BEHAVIOR_INDEX_BUCKETS - 1);
+}
+
+static s32 behavior_index_find_bucket(const BehaviorScript *behavior, bool create) {
+    u32 slot = behavior_index_hash(behavior);
+    for (u32 i = 0; i < BEHAVIOR_INDEX_BUCKETS; i++) {
+        struct BehaviorIndexBucket *bucket = &sBehaviorIndexBuckets[slot];
+        if (bucket->behavior == behavior) { return slot; }
+        if (bucket->behavior == NULL) {
+            if (!create) { return BEHAVIOR_INDEX_NONE; }
+            bucket->behavior = behavior;
+            bucket->head = BEHAVIOR_INDEX_NONE;
+            bucket->tail = BEHAVIOR_INDEX_NONE;
+            bucket->count = 0;
+            sBehaviorIndexUsedBuckets++;
+            return slot;
+        }
+        slot = (slot + 1) & (BEHAVIOR_INDEX_BUCKETS - 1);
+    }
+    return BEHAVIOR_INDEX_NONE;
+}
+
+// Rehash the buckets that still hold objects, the object links stay as they are
+static void behavior_index_compact(void) {
+    static struct BehaviorIndexBucket sOldBuckets[BEHAVIOR_INDEX_BUCKETS];
+    memcpy(sOldBuckets, sBehaviorIndexBuckets, sizeof(sOldBuckets));
+    memset(sBehaviorIndexBuckets, 0, sizeof(sBehaviorIndexBuckets));
+    sBehaviorIndexUsedBuckets = 0;
+
+    for (s32 i = 0; i < BEHAVIOR_INDEX_BUCKETS; i++) {
+        struct BehaviorIndexBucket *old = &sOldBuckets[i];
+        if (old->behavior == NULL || old->count == 0) { continue; }
+
+        s32 slot = behavior_index_find_bucket(old->behavior, true);
+        sBehaviorIndexBuckets[slot] = *old;
+        for (s16 index = old->head; index != BEHAVIOR_INDEX_NONE; index = sBehaviorIndexNext[index]) {
+            sBehaviorIndexBucketOf[index] = slot;
+        }
+    }
+}
+
+void obj_behavior_index_clear(void) {
+    memset(sBehaviorIndexBuckets, 0, sizeof(sBehaviorIndexBuckets));
+    sBehaviorIndexUsedBuckets = 0;
+    for (s32 i = 0; i < OBJECT_POOL_CAPACITY; i++) {
+        sBehaviorIndexNext[i] = BEHAVIOR_INDEX_NONE;
+        sBehaviorIndexPrev[i] = BEHAVIOR_INDEX_NONE;
+        sBehaviorIndexBucketOf[i] = BEHAVIOR_INDEX_NONE;
+    }
+    sBehaviorIndexInitialized = true;
+}
+
+void obj_behavior_index_remove(struct Object *obj) {
+    s32 index = behavior_index_pool_index(obj);
+    if (index == BEHAVIOR_INDEX_NONE) { return; }
+
+    s16 slot = sBehaviorIndexBucketOf[index];
+    if (slot == BEHAVIOR_INDEX_NONE) { return; }
+    struct BehaviorIndexBucket *bucket = &sBehaviorIndexBuckets[slot];
+
+    s16 prev = sBehaviorIndexPrev[index];
+    s16 next = sBehaviorIndexNext[index];
+    if (prev != BEHAVIOR_INDEX_NONE) { sBehaviorIndexNext[prev] = next; } else { bucket->head = next; }
+    if (next != BEHAVIOR_INDEX_NONE) { sBehaviorIndexPrev[next] = prev; } else { bucket->tail = prev; }
+    bucket->count--;
+
+    sBehaviorIndexNext[index] = BEHAVIOR_INDEX_NONE;
+    sBehaviorIndexPrev[index] = BEHAVIOR_INDEX_NONE;
+    sBehaviorIndexBucketOf[index] = BEHAVIOR_INDEX_NONE;
+}
+
+void obj_behavior_index_update(struct Object *obj) {
+    s32 index = behavior_index_pool_index(obj);
+    if (index == BEHAVIOR_INDEX_NONE) { return; }
+
+    // already indexed under its current behavior
+    s16 slot = sBehaviorIndexBucketOf[index];
+    if (slot != BEHAVIOR_INDEX_NONE && sBehaviorIndexBuckets[slot].behavior == obj->behavior) { return; }
+
+    obj_behavior_index_remove(obj);
+    if (obj->behavior == NULL) { return; }
+
+    if (sBehaviorIndexUsedBuckets >= BEHAVIOR_INDEX_MAX_USED_BUCKETS) {
+        behavior_index_compact();
+    }
+    slot = behavior_index_find_bucket(obj->behavior, true);
+    if (slot == BEHAVIOR_INDEX_NONE) { return; }
+    struct BehaviorIndexBucket *bucket = &sBehaviorIndexBuckets[slot];
+
+    // append, objects are also appended to their object list when spawned
+    sBehaviorIndexPrev[index] = bucket->tail;
+    sBehaviorIndexNext[index] = BEHAVIOR_INDEX_NONE;
+    if (bucket->tail != BEHAVIOR_INDEX_NONE) {
+        sBehaviorIndexNext[bucket->tail] = index;
+    } else {
+        bucket->head = index;
+    }
+    bucket->tail = index;
+    bucket->count++;
+    sBehaviorIndexBucketOf[index] = slot;
+}
+
+struct Object *obj_behavior_index_first(const BehaviorScript *behavior) {
+    if (!sBehaviorIndexInitialized || behavior == NULL) { return NULL; }
+    s32 slot = behavior_index_find_bucket(behavior, false);
+    if (slot == BEHAVIOR_INDEX_NONE || sBehaviorIndexBuckets[slot].head == BEHAVIOR_INDEX_NONE) { return NULL; }
+    return &gObjectPool[sBehaviorIndexBuckets[slot].head];
+}
+
+struct Object *obj_behavior_index_next(struct Object *obj) {
+    s32 index = behavior_index_pool_index(obj);
+    if (index == BEHAVIOR_INDEX_NONE) { return NULL; }
+    s16 next = sBehaviorIndexNext[index];
+    return (next != BEHAVIOR_INDEX_NONE) ? &gObjectPool[next] : NULL;
+}
+
+s32 obj_behavior_index_count(const BehaviorScript *behavior) {
+    if (!sBehaviorIndexInitialized || behavior == NULL) { return 0; }
+    s32 slot = behavior_index_find_bucket(behavior, false);
+    return (slot != BEHAVIOR_INDEX_NONE) ? sBehaviorIndexBuckets[slot].count : 0;
+}
@@ -0,0 +1,17 @@
+#ifndef OBJECT_BEHAVIOR_INDEX_H
+#define OBJECT_BEHAVIOR_INDEX_H
+
+#include "types.h"
+
+// Keeps every allocated object in a list per behavior, in spawn order, so that
+// behavior queries don't have to walk the whole object list.
+// Objects must be re-indexed whenever their behavior changes.
+
+void obj_behavior_index_clear(void);
+void obj_behavior_index_update(struct Object *obj);
+void obj_behavior_index_remove(struct Object *obj);
+struct Object *obj_behavior_index_first(const BehaviorScript *behavior);
+struct Object *obj_behavior_index_next(struct Object *obj);
+s32 obj_behavior_index_count(const BehaviorScript *behavior);
+
+#endif // OBJECT_BEHAVIOR_INDEX_H
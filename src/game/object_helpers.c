@@ -22,6 +22,7 @@
 #include "mario_actions_cutscene.h"
 #include "memory.h"
 #include "obj_behaviors.h"
+#include "object_behavior_index.h"
 #include "object_helpers.h"
 #include "object_list_processor.h"
 #include "rendering_graph_node.h"
@@ -1085,25 +1086,18 @@ struct Object *cur_obj_find_nearest_object_with_behavior(const BehaviorScript *b
     uintptr_t *behaviorAddr = segmented_to_virtual(behavior);
     struct Object *closestObj = NULL;
     struct Object *obj;
-    struct ObjectNode *listHead;
     f32 minDist = 0x20000;
     u32 objList = get_object_list_from_behavior(behaviorAddr);
     if (objList >= NUM_OBJ_LISTS) { return NULL; }
 
-    listHead = &gObjectLists[objList];
-    obj = (struct Object *) listHead->next;
-
-    while (obj && obj != (struct Object *) listHead) {
-        if (obj->behavior == behaviorAddr) {
-            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj != o) {
-                f32 objDist = dist_between_objects(o, obj);
-                if (objDist < minDist) {
-                    closestObj = obj;
-                    minDist = objDist;
-                }
+    for (obj = obj_behavior_index_first(behaviorAddr); obj != NULL; obj = obj_behavior_index_next(obj)) {
+        if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj != o) {
+            f32 objDist = dist_between_objects(o, obj);
+            if (objDist < minDist) {
+                closestObj = obj;
+                minDist = objDist;
             }
         }
-        obj = (struct Object *) obj->header.next;
     }
 
     *dist = minDist;
@@ -1116,24 +1110,17 @@ u16 cur_obj_count_objects_with_behavior(const BehaviorScript* behavior, f32 dist
     u16 numObjs = 0;
     uintptr_t* behaviorAddr = segmented_to_virtual(behavior);
     struct Object* obj;
-    struct ObjectNode* listHead;
 
     u32 objList = get_object_list_from_behavior(behaviorAddr);
     if (objList >= NUM_OBJ_LISTS) { return 0; }
 
-    listHead = &gObjectLists[objList];
-    obj = (struct Object*)listHead->next;
-
-    while (obj && obj != (struct Object*)listHead) {
-        if (obj->behavior == behaviorAddr) {
-            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj != o) {
-                f32 objDist = dist_between_objects(o, obj);
-                if (objDist < dist) {
-                    numObjs++;
-                }
+    for (obj = obj_behavior_index_first(behaviorAddr); obj != NULL; obj = obj_behavior_index_next(obj)) {
+        if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj != o) {
+            f32 objDist = dist_between_objects(o, obj);
+            if (objDist < dist) {
+                numObjs++;
             }
         }
-        obj = (struct Object*)obj->header.next;
     }
 
     return numObjs;
@@ -1171,19 +1158,7 @@ s32 count_objects_with_behavior(const BehaviorScript *behavior) {
     u32 objList = get_object_list_from_behavior(behaviorAddr);
     if (objList >= NUM_OBJ_LISTS) { return 0; }
 
-    struct ObjectNode *listHead = &gObjectLists[objList];
-    struct ObjectNode *obj = listHead->next;
-    s32 count = 0;
-
-    while (obj && listHead != obj) {
-        if (((struct Object *) obj)->behavior == behaviorAddr) {
-            count++;
-        }
-
-        obj = obj->next;
-    }
-
-    return count;
+    return obj_behavior_index_count(behaviorAddr);
 }
 
 struct Object *find_object_with_behavior(const BehaviorScript *behavior) {
@@ -1193,18 +1168,7 @@ struct Object *find_object_with_behavior(const BehaviorScript *behavior) {
     u32 objList = get_object_list_from_behavior(behaviorAddr);
     if (objList >= NUM_OBJ_LISTS) { return 0; }
 
-    struct ObjectNode *listHead = &gObjectLists[objList];
-    struct ObjectNode *obj = listHead->next;
-
-    while (listHead != obj) {
-        if (((struct Object *) obj)->behavior == behaviorAddr) {
-            return (struct Object *)obj;
-        }
-
-        obj = obj->next;
-    }
-
-    return NULL;
+    return obj_behavior_index_first(behaviorAddr);
 }
 
 struct Object *cur_obj_find_nearby_held_actor(const BehaviorScript *behavior, f32 maxDist) {
@@ -1809,11 +1773,13 @@ s32 obj_check_if_collided_with_object(struct Object *obj1, struct Object *obj2)
 void cur_obj_set_behavior(const BehaviorScript *behavior) {
     if (!o) { return; }
     o->behavior = segmented_to_virtual(behavior);
+    obj_behavior_index_update(o);
 }
 
 void obj_set_behavior(struct Object *obj, const BehaviorScript *behavior) {
     if (!obj) { return; }
     obj->behavior = segmented_to_virtual(behavior);
+    obj_behavior_index_update(obj);
 }
 
 s32 cur_obj_has_behavior(const BehaviorScript *behavior) {
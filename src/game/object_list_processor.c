@@ -13,6 +13,7 @@
 #include "level_update.h"
 #include "mario.h"
 #include "memory.h"
+#include "object_behavior_index.h"
 #include "object_collision.h"
 #include "object_helpers.h"
 #include "object_list_processor.h"
@@ -545,6 +546,7 @@ void spawn_objects_from_info(UNUSED s32 unused, struct SpawnInfo *spawnInfo) {
                 object->oBehParams2ndByte = ((spawnInfo->behaviorArg) >> 16) & 0xFF;
 
                 object->behavior = smlua_override_behavior(script);
+                obj_behavior_index_update(object);
                 object->unused1 = 0;
 
                 // set the sync id
@@ -615,6 +617,7 @@ void clear_objects(void) {
 
     init_free_object_list();
     clear_object_lists(gObjectListArray);
+    obj_behavior_index_clear();
 
     for (i = 0; i < OBJECT_POOL_CAPACITY; i++) {
         gObjectPool[i].activeFlags = ACTIVE_FLAG_DEACTIVATED;
@@ -999,11 +999,38 @@ void painting_update_ripple_state(struct Painting *painting) {
     }
 }
 
+/// Ripple origins: the single ripple of continuous ripple paintings, then one per Mario
+#define PAINTING_RIPPLE_ORIGINS (MAX_PLAYERS + 2)
+
 /**
- * @return the ripple function at posX, posY
- * note that posX and posY correspond to a point on the face of the painting, not actual axes
+ * Get the origin of one of the painting's ripples.
+ * Origin 0 is the single ripple of continuous ripple paintings, the others are each Mario's ripple.
+ * @return whether that ripple is currently used by calculate_ripple_at_point
  */
-s16 calculate_ripple_at_point(struct Painting *painting, f32 posX, f32 posY) {
+static bool painting_ripple_origin(struct Painting *painting, s32 origin, f32 *rippleX, f32 *rippleY) {
+    // Do not do multiple ripples for continuous ripple paintings, like DDD or HMC
+    bool single = (painting->rippleTrigger == RIPPLE_TRIGGER_CONTINUOUS);
+
+    if (origin == 0) {
+        *rippleX = painting->rippleX;
+        *rippleY = painting->rippleY;
+        return single;
+    }
+
+    s32 i = origin - 1;
+    *rippleX = painting->ripples.rippleXs[i];
+    *rippleY = painting->ripples.rippleYs[i];
+    if (single) { return false; }
+    if (painting->ripples.rippleTimers[i] < 0) { return false; }
+    if (painting->ripples.currRippleMags[i] < 1) { return false; }
+    return true;
+}
+
+/**
+ * @return the ripple function at a point, given its distance to each ripple origin
+ * Only the distances of the origins that painting_ripple_origin reports as used are read.
+ */
+static s16 calculate_ripple_from_distances(struct Painting *painting, f32 *distances) {
     /// Controls the ripple's frequency
     f32 rippleRate = painting->currRippleRate;
     /// Controls how fast the ripple spreads
@@ -1017,9 +1044,6 @@ s16 calculate_ripple_at_point(struct Painting *painting, f32 posX, f32 posY) {
         multiRippleMode = SINGLE_RIPPLE;
     }
 
-    posX *= painting->size / PAINTING_SIZE;
-    posY *= painting->size / PAINTING_SIZE;
-
     // For calculating the highest ripple, ans needs to start extremely low otherwise ripples under 0 won't be counted
     s16 ans = multiRippleMode == HIGHEST_RIPPLE ? -32000 : 0;
     bool flat = true;
@@ -1035,11 +1059,8 @@ s16 calculate_ripple_at_point(struct Painting *painting, f32 posX, f32 posY) {
             f32 rippleMag = painting->ripples.currRippleMags[i];
             /// How far the ripple has spread
             f32 rippleTimer = painting->ripples.rippleTimers[i];
-            /// x and y ripple origin
-            f32 rippleX = painting->ripples.rippleXs[i];
-            f32 rippleY = painting->ripples.rippleYs[i];
 
-            distanceToOrigin = sqrtf((posX - rippleX) * (posX - rippleX) + (posY - rippleY) * (posY - rippleY));
+            distanceToOrigin = distances[i + 1];
             // A larger dispersionFactor makes the ripple spread slower
             rippleDistance = distanceToOrigin / dispersionFactor;
             f32 rippleZ = 0;
@@ -1078,11 +1099,8 @@ s16 calculate_ripple_at_point(struct Painting *painting, f32 posX, f32 posY) {
         f32 rippleMag = painting->currRippleMag;
         /// How far the ripple has spread
         f32 rippleTimer = painting->rippleTimer;
-        /// x and y ripple origin
-        f32 rippleX = painting->rippleX;
-        f32 rippleY = painting->rippleY;
 
-        distanceToOrigin = sqrtf((posX - rippleX) * (posX - rippleX) + (posY - rippleY) * (posY - rippleY));
+        distanceToOrigin = distances[0];
         // A larger dispersionFactor makes the ripple spread slower
         rippleDistance = distanceToOrigin / dispersionFactor;
         f32 rippleZ = 0;
@@ -1098,6 +1116,26 @@ s16 calculate_ripple_at_point(struct Painting *painting, f32 posX, f32 posY) {
     return ans;
 }
 
+/**
+ * @return the ripple function at posX, posY
+ * note that posX and posY correspond to a point on the face of the painting, not actual axes
+ */
+s16 calculate_ripple_at_point(struct Painting *painting, f32 posX, f32 posY) {
+    f32 distances[PAINTING_RIPPLE_ORIGINS];
+
+    posX *= painting->size / PAINTING_SIZE;
+    posY *= painting->size / PAINTING_SIZE;
+
+    for (s32 origin = 0; origin < PAINTING_RIPPLE_ORIGINS; origin++) {
+        f32 rippleX;
+        f32 rippleY;
+        if (!painting_ripple_origin(painting, origin, &rippleX, &rippleY)) { continue; }
+        distances[origin] = sqrtf((posX - rippleX) * (posX - rippleX) + (posY - rippleY) * (posY - rippleY));
+    }
+
+    return calculate_ripple_from_distances(painting, distances);
+}
+
 /**
  * If movable, return the ripple function at (posX, posY)
  * else return 0
@@ -1112,7 +1150,119 @@ s16 ripple_if_movable(struct Painting *painting, s16 movable, s16 posX, s16 posY
 }
 
 /**
- * Allocates and generates a mesh for the rippling painting effect by modifying the passed in `mesh`
+ * The mesh of the painting that is being drawn. Only one painting's mesh is generated at a time,
+ * so the buffers are shared and kept between frames instead of being allocated every frame.
+ */
+static struct PaintingMeshVertex *sPaintingMeshBuffer = NULL;
+static Vec3f *sPaintingTriNormsBuffer = NULL;
+static s16 sPaintingMeshBufferVtx = 0;
+static s16 sPaintingMeshBufferTris = 0;
+
+/**
+ * Distance from each mesh vertex to each ripple origin, for the last few paintings that rippled.
+ * A ripple's origin is only set when it starts, so the distances rarely need to be recomputed.
+ */
+struct PaintingDistanceCache {
+    struct Painting *painting;
+    u32 lastUsed;
+    s16 numVtx;
+    f32 *distances;
+    f32 originXs[PAINTING_RIPPLE_ORIGINS];
+    f32 originYs[PAINTING_RIPPLE_ORIGINS];
+    f32 originSizes[PAINTING_RIPPLE_ORIGINS];
+    bool originValid[PAINTING_RIPPLE_ORIGINS];
+};
+
+#define PAINTING_DISTANCE_CACHES 4
+static struct PaintingDistanceCache sPaintingDistanceCaches[PAINTING_DISTANCE_CACHES] = { 0 };
+
+/**
+ * Make sure the shared mesh buffers fit the mesh, and point the painting at them.
+ */
+static bool painting_alloc_mesh(struct Painting *painting, s16 numVtx, s16 numTris) {
+    if (sPaintingMeshBufferVtx < numVtx) {
+        free(sPaintingMeshBuffer);
+        sPaintingMeshBuffer = malloc(numVtx * sizeof(struct PaintingMeshVertex));
+        sPaintingMeshBufferVtx = (sPaintingMeshBuffer != NULL) ? numVtx : 0;
+    }
+    if (sPaintingMeshBufferTris < numTris) {
+        free(sPaintingTriNormsBuffer);
+        sPaintingTriNormsBuffer = malloc(numTris * sizeof(Vec3f));
+        sPaintingMeshBufferTris = (sPaintingTriNormsBuffer != NULL) ? numTris : 0;
+    }
+
+    gPaintingMesh = (sPaintingMeshBufferVtx > 0) ? sPaintingMeshBuffer : NULL;
+    gPaintingTriNorms = (sPaintingMeshBufferTris > 0) ? sPaintingTriNormsBuffer : NULL;
+    painting->ripples.paintingMesh = gPaintingMesh;
+    painting->ripples.paintingTriNorms = gPaintingTriNorms;
+    return (gPaintingMesh != NULL && gPaintingTriNorms != NULL);
+}
+
+/**
+ * Find the painting's distance cache, or take over the one that was used the longest ago.
+ */
+static struct PaintingDistanceCache *painting_get_distance_cache(struct Painting *painting, s16 numVtx) {
+    struct PaintingDistanceCache *cache = &sPaintingDistanceCaches[0];
+    for (s32 i = 0; i < PAINTING_DISTANCE_CACHES; i++) {
+        struct PaintingDistanceCache *other = &sPaintingDistanceCaches[i];
+        if (other->painting == painting) {
+            cache = other;
+            break;
+        }
+        if (other->lastUsed < cache->lastUsed) {
+            cache = other;
+        }
+    }
+
+    if (cache->painting != painting || cache->numVtx != numVtx) {
+        if (cache->numVtx != numVtx) {
+            free(cache->distances);
+            cache->distances = malloc(numVtx * PAINTING_RIPPLE_ORIGINS * sizeof(f32));
+            cache->numVtx = (cache->distances != NULL) ? numVtx : 0;
+        }
+        cache->painting = painting;
+        memset(cache->originValid, 0, sizeof(cache->originValid));
+    }
+
+    cache->lastUsed = gGlobalTimer;
+    return (cache->distances != NULL) ? cache : NULL;
+}
+
+/**
+ * Recompute the distance from each vertex to the ripple origins that moved since they were last used.
+ */
+static void painting_update_origin_distances(struct Painting *painting, struct PaintingDistanceCache *cache, s16 *mesh, s16 numVtx) {
+    for (s32 origin = 0; origin < PAINTING_RIPPLE_ORIGINS; origin++) {
+        f32 rippleX;
+        f32 rippleY;
+        if (!painting_ripple_origin(painting, origin, &rippleX, &rippleY)) { continue; }
+
+        if (cache->originValid[origin]
+            && cache->originXs[origin] == rippleX
+            && cache->originYs[origin] == rippleY
+            && cache->originSizes[origin] == painting->size) {
+            continue;
+        }
+
+        for (s16 i = 0; i < numVtx; i++) {
+            // same as calculate_ripple_at_point, so that the mesh doesn't change
+            f32 posX = mesh[i * 3 + 1];
+            f32 posY = mesh[i * 3 + 2];
+            posX *= painting->size / PAINTING_SIZE;
+            posY *= painting->size / PAINTING_SIZE;
+            cache->distances[i * PAINTING_RIPPLE_ORIGINS + origin] =
+                sqrtf((posX - rippleX) * (posX - rippleX) + (posY - rippleY) * (posY - rippleY));
+        }
+
+        cache->originXs[origin] = rippleX;
+        cache->originYs[origin] = rippleY;
+        cache->originSizes[origin] = painting->size;
+        cache->originValid[origin] = true;
+    }
+}
+
+/**
+ * Generates a mesh for the rippling painting effect by modifying the passed in `mesh`
  * based on the painting's current ripple state.
  *
  * The `mesh` table describes the location of mesh vertices, whether they move when rippling, and what
@@ -1133,20 +1283,29 @@ s16 ripple_if_movable(struct Painting *painting, s16 movable, s16 posX, s16 posY
 void painting_generate_mesh(struct Painting *painting, s16 *mesh, s16 numTris) {
     s16 i;
 
-    gPaintingMesh = dynamic_pool_alloc(gLevelPool, numTris * sizeof(struct PaintingMeshVertex));
-    painting->ripples.paintingMesh = gPaintingMesh;
     if (painting->ripples.paintingMesh == NULL) {
         return;
     }
 
+    struct PaintingDistanceCache *cache = painting_get_distance_cache(painting, numTris);
+    if (cache != NULL) {
+        painting_update_origin_distances(painting, cache, mesh, numTris);
+    }
+
     // accesses are off by 1 since the first entry is the number of vertices
     for (i = 0; i < numTris; i++) {
         painting->ripples.paintingMesh[i].pos[0] = mesh[i * 3 + 1];
         painting->ripples.paintingMesh[i].pos[1] = mesh[i * 3 + 2];
         // The "z coordinate" of each vertex in the mesh is either 1 or 0. Instead of being an
         // actual coordinate, it just determines whether the vertex moves
-        painting->ripples.paintingMesh[i].pos[2] = ripple_if_movable(painting, mesh[i * 3 + 3],
-                                                    painting->ripples.paintingMesh[i].pos[0], painting->ripples.paintingMesh[i].pos[1]);
+        if (cache != NULL) {
+            painting->ripples.paintingMesh[i].pos[2] = mesh[i * 3 + 3]
+                ? calculate_ripple_from_distances(painting, &cache->distances[i * PAINTING_RIPPLE_ORIGINS])
+                : 0;
+        } else {
+            painting->ripples.paintingMesh[i].pos[2] = ripple_if_movable(painting, mesh[i * 3 + 3],
+                                                        painting->ripples.paintingMesh[i].pos[0], painting->ripples.paintingMesh[i].pos[1]);
+        }
     }
 }
 
@@ -1168,9 +1327,7 @@ void painting_generate_mesh(struct Painting *painting, s16 *mesh, s16 numTris) {
 void painting_calculate_triangle_normals(struct Painting *painting, s16 *mesh, s16 numVtx, s16 numTris) {
     s16 i;
 
-    gPaintingTriNorms = dynamic_pool_alloc(gLevelPool, numTris * sizeof(Vec3f));
-    painting->ripples.paintingTriNorms = gPaintingTriNorms;
-    if (painting->ripples.paintingTriNorms == NULL) {
+    if (painting->ripples.paintingMesh == NULL || painting->ripples.paintingTriNorms == NULL) {
         return;
     }
 
@@ -1501,7 +1658,7 @@ Gfx *painting_ripple_env_mapped(struct Painting *painting) {
 
 /**
  * Generates a mesh, calculates vertex normals for lighting, and renders a rippling painting.
- * The mesh and vertex normals are regenerated and freed every frame.
+ * The mesh and vertex normals are regenerated every frame, into buffers shared by all paintings.
  */
 Gfx *display_painting_rippling(struct Painting *painting) {
     s16 *mesh = segmented_to_virtual(seg2_painting_triangle_mesh);
@@ -1510,6 +1667,10 @@ Gfx *display_painting_rippling(struct Painting *painting) {
     s16 numTris = mesh[numVtx * 3 + 1];
     Gfx *dlist = NULL;
 
+    if (!painting_alloc_mesh(painting, numVtx, numTris)) {
+        return NULL;
+    }
+
     // Generate the mesh and its lighting data
     painting_generate_mesh(painting, mesh, numVtx);
     painting_calculate_triangle_normals(painting, mesh, numVtx, numTris);
@@ -1525,15 +1686,9 @@ Gfx *display_painting_rippling(struct Painting *painting) {
             break;
     }
 
-    // The mesh data is freed every frame.
-    if (painting->ripples.paintingMesh) {
-        dynamic_pool_free(gLevelPool, painting->ripples.paintingMesh);
-        painting->ripples.paintingMesh = NULL;
-    }
-    if (painting->ripples.paintingTriNorms) {
-        dynamic_pool_free(gLevelPool, painting->ripples.paintingTriNorms);
-        painting->ripples.paintingTriNorms = NULL;
-    }
+    // The mesh buffers are only the painting's while it's drawn.
+    painting->ripples.paintingMesh = NULL;
+    painting->ripples.paintingTriNorms = NULL;
     return dlist;
 }
 
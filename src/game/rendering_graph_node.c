@@ -287,6 +287,10 @@ void patch_mtx_interpolated(f32 delta) {
     for (s32 i = 0; i < sShadowInterpCount; i++) {
         struct ShadowInterp* interp = &sShadowInterp[i];
         if (!interp->gfx) { continue; }
+
+        // a shadow that didn't move over level geometry is the same as the one built this tick
+        if (interp->staticFloors) { continue; }
+
         gShadowInterpCurrent = interp;
         Vec3f posInterp;
         delta_interpolate_vec3f(posInterp, interp->shadowPosPrev, interp->shadowPos, delta);
@@ -307,6 +311,10 @@ void patch_mtx_interpolated(f32 delta) {
         mtxf_inverse(prevCamTranfInv.m, *sCameraNode->matrixPtrPrev);
     }
 
+    // the interpolated camera transform is the same for every matrix, only compute it once
+    Mtx camInterp;
+    bool camInterpComputed = false;
+
     for (s32 i = 0; i < gMtxTblSize; i++) {
         Mtx bufMtx, bufMtxPrev;
 
@@ -323,14 +331,16 @@ void patch_mtx_interpolated(f32 delta) {
         delta_interpolate_mtx(&gMtxTbl[i].interp, &bufMtxPrev, &bufMtx, delta);
         if (gMtxTbl[i].usingCamSpace) {
             // transform back to camera space, respecting camera interpolation
-            Mtx camInterp;
-            Vec3f posInterp, focusInterp;
-
-            // use camera node's stored information to calculate interpolated camera transform
-            delta_interpolate_vec3f(posInterp, sCameraNode->prevPos, sCameraNode->pos, delta);
-            delta_interpolate_vec3f(focusInterp, sCameraNode->prevFocus, sCameraNode->focus, delta);
-            mtxf_lookat(camInterp.m, posInterp, focusInterp, sCameraNode->roll);
-            mtxf_to_mtx(&camInterp, camInterp.m);
+            if (!camInterpComputed) {
+                Vec3f posInterp, focusInterp;
+
+                // use camera node's stored information to calculate interpolated camera transform
+                delta_interpolate_vec3f(posInterp, sCameraNode->prevPos, sCameraNode->pos, delta);
+                delta_interpolate_vec3f(focusInterp, sCameraNode->prevFocus, sCameraNode->focus, delta);
+                mtxf_lookat(camInterp.m, posInterp, focusInterp, sCameraNode->roll);
+                mtxf_to_mtx(&camInterp, camInterp.m);
+                camInterpComputed = true;
+            }
             mtxf_mul(gMtxTbl[i].interp.m, gMtxTbl[i].interp.m, camInterp.m);
         }
         gSPMatrix(pos++, VIRTUAL_TO_PHYSICAL(&gMtxTbl[i].interp),
@@ -1093,6 +1103,8 @@ static void geo_process_shadow(struct GraphNodeShadow *node) {
             interp->obj = gCurGraphNodeObject;
             vec3f_copy(interp->shadowPos, gCurGraphNodeObject->shadowPos);
             vec3f_copy(interp->shadowPosPrev, shadowPosPrev);
+            interp->staticFloors = (memcmp(shadowPosPrev, gCurGraphNodeObject->shadowPos, sizeof(Vec3f)) == 0)
+                                && shadow_is_above_static_floors(shadowPosPrev[0], shadowPosPrev[2], shadowScale, node->shadowType);
         } else {
             gShadowInterpCurrent = NULL;
         }
@@ -55,6 +55,7 @@ struct ShadowInterp {
     struct GraphNodeShadow *node;
     f32 shadowScale;
     struct GraphNodeObject *obj;
+    bool staticFloors; // the shadow doesn't need to be rebuilt on interpolated frames
 };
 
 #endif // RENDERING_GRAPH_NODE_H
@@ -4,6 +4,7 @@
 
 #include "engine/math_util.h"
 #include "engine/surface_collision.h"
+#include "engine/surface_load.h"
 #include "geo_misc.h"
 #include "level_table.h"
 #include "memory.h"
@@ -978,3 +979,43 @@ Gfx *create_shadow_below_xyz(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale, u8 s
     }
     return displayList;
 }
+
+/**
+ * Return TRUE if no object floors are loaded in the cells covered by a shadow
+ * at the given position (the larger of its scale and its hardcoded rectangle), meaning its floor queries only hit level geometry
+ * and give the same result for the whole frame.
+ */
+s8 shadow_is_above_static_floors(f32 xPos, f32 zPos, s16 shadowScale, s8 shadowType) {
+    f32 extent = shadowScale;
+
+    // hardcoded rectangles have their own size, reaching up to their corners
+    s8 idx = shadowType - SHADOW_RECTANGLE_HARDCODED_OFFSET;
+    if (idx >= 0 && idx < (s8) ARRAY_COUNT(rectangles)) {
+        f32 corner = sqrtf(sqr(rectangles[idx].halfWidth) + sqr(rectangles[idx].halfLength));
+        extent = MAX(extent, corner);
+    }
+
+    s16 minX = (s16) (xPos - extent);
+    s16 maxX = (s16) (xPos + extent);
+    s16 minZ = (s16) (zPos - extent);
+    s16 maxZ = (s16) (zPos + extent);
+
+    s16 minCellX = ((minX + LEVEL_BOUNDARY_MAX) / CELL_SIZE) & NUM_CELLS_INDEX;
+    s16 maxCellX = ((maxX + LEVEL_BOUNDARY_MAX) / CELL_SIZE) & NUM_CELLS_INDEX;
+    s16 minCellZ = ((minZ + LEVEL_BOUNDARY_MAX) / CELL_SIZE) & NUM_CELLS_INDEX;
+    s16 maxCellZ = ((maxZ + LEVEL_BOUNDARY_MAX) / CELL_SIZE) & NUM_CELLS_INDEX;
+
+    // wrapped around the level boundary, don't bother
+    if (minCellX > maxCellX || minCellZ > maxCellZ) {
+        return FALSE;
+    }
+
+    for (s16 cellZ = minCellZ; cellZ <= maxCellZ; cellZ++) {
+        for (s16 cellX = minCellX; cellX <= maxCellX; cellX++) {
+            if (gDynamicSurfacePartition[cellZ][cellX][SPATIAL_PARTITION_FLOORS].next != NULL) {
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
@@ -51,4 +51,10 @@ extern s8 gMarioOnIceOrCarpet;
  */
 Gfx *create_shadow_below_xyz(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale, u8 shadowSolidity, s8 shadowType);
 
+/**
+ * Return TRUE if a shadow at the given position can only be cast on level
+ * geometry, so building it again with the same position gives the same result.
+ */
+s8 shadow_is_above_static_floors(f32 xPos, f32 zPos, s16 shadowScale, s8 shadowType);
+
 #endif // SHADOW_H
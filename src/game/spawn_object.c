@@ -10,6 +10,7 @@
 #include "object_constants.h"
 #include "object_fields.h"
 #include "object_helpers.h"
+#include "object_behavior_index.h"
 #include "object_list_processor.h"
 #include "spawn_object.h"
 #include "types.h"
@@ -247,6 +248,7 @@ void unload_object(struct Object *obj) {
 
     smlua_call_event_hooks_object_param(HOOK_ON_OBJECT_UNLOAD, obj);
 
+    obj_behavior_index_remove(obj);
     deallocate_object(&gFreeObjectList, &obj->header);
 }
 
@@ -339,6 +341,7 @@ struct Object *allocate_object(struct ObjectNode *objList) {
     obj->areaTimer = 0;
     obj->areaTimerDuration = 0;
     obj->areaTimerRunOnceCallback = NULL;
+    obj->areaTimerFastForwardCallback = NULL;
     obj->setHome = FALSE;
     obj->allowRemoteInteractions = FALSE;
 
@@ -391,6 +394,7 @@ struct Object *create_object(const BehaviorScript *bhvScript) {
 
     obj->curBhvCommand = luaBehavior ? bhvScript : behavior;
     obj->behavior = behavior;
+    obj_behavior_index_update(obj);
 
     if (objListIndex == OBJ_LIST_UNIMPORTANT) {
         obj->activeFlags |= ACTIVE_FLAG_UNIMPORTANT;
@@ -146,6 +146,7 @@ void djui_reset_hud_params(void) {
     djui_hud_set_font(FONT_NORMAL);
     djui_hud_set_rotation(0, 0, 0);
     djui_hud_reset_color();
+    djui_hud_reset_text_outline();
     djui_hud_set_filter(FILTER_NEAREST);
 }
 
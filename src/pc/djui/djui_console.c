@@ -20,6 +20,12 @@ struct ConsoleQueuedMessage {
 };
 
 struct ConsoleQueuedMessage* sConsoleQueuedMessages = NULL;
+static struct ConsoleQueuedMessage* sConsoleQueuedMessagesTail = NULL;
+
+// Message widgets from oldest to newest. Once the console is full, the oldest
+// widget is moved to the front of the flow and reused for the new message.
+static struct DjuiBaseChild* sConsoleMessageChildren[MAX_CONSOLE_MESSAGES] = { 0 };
+static u32 sConsoleMessageOldest = 0;
 
 static void djui_console_message_queue(const char* message, enum ConsoleMessageLevel level) {
     struct ConsoleQueuedMessage* queued = malloc(sizeof(struct ConsoleQueuedMessage));
@@ -28,12 +34,10 @@ static void djui_console_message_queue(const char* message, enum ConsoleMessageL
     queued->next = NULL;
     if (sConsoleQueuedMessages == NULL) {
         sConsoleQueuedMessages = queued;
-        return;
+    } else {
+        sConsoleQueuedMessagesTail->next = queued;
     }
-
-    struct ConsoleQueuedMessage* entry = sConsoleQueuedMessages;
-    while (entry->next) { entry = entry->next; }
-    entry->next = queued;
+    sConsoleQueuedMessagesTail = queued;
 }
 
 void djui_console_message_dequeue(void) {
@@ -48,6 +52,7 @@ void djui_console_message_dequeue(void) {
         entry = next;
     }
     sConsoleQueuedMessages = NULL;
+    sConsoleQueuedMessagesTail = NULL;
 }
 
 bool djui_console_render(struct DjuiBase* base) {
@@ -131,6 +136,34 @@ static bool djui_console_on_key_down(UNUSED struct DjuiBase* base, int scancode)
     return true;
 }
 
+static struct DjuiText* djui_console_message_reuse_oldest(const char* message) {
+    struct DjuiBase* cfBase = &gDjuiConsole->flow->base;
+    struct DjuiBaseChild* oldest = sConsoleMessageChildren[sConsoleMessageOldest];
+    struct DjuiBaseChild* secondOldest = sConsoleMessageChildren[(sConsoleMessageOldest + 1) % MAX_CONSOLE_MESSAGES];
+
+    // remove its height from the flow
+    f32 heightAdjust = oldest->base->height.value + gDjuiConsole->flow->margin.value;
+    cfBase->height.value -= heightAdjust;
+    if (gDjuiConsole->scrolling && gDjuiConsole->scrollY != 0) {
+        cfBase->y.value += heightAdjust;
+        gDjuiConsole->scrollY += heightAdjust;
+    }
+
+    // the oldest message is always the last child, move it to the head
+    if (oldest != cfBase->child) {
+        secondOldest->next = NULL;
+        oldest->next = cfBase->child;
+        cfBase->child = oldest;
+    }
+
+    // it's now the newest message, which takes the oldest message's slot
+    sConsoleMessageOldest = (sConsoleMessageOldest + 1) % MAX_CONSOLE_MESSAGES;
+
+    struct DjuiText* text = (struct DjuiText*)oldest->base;
+    djui_text_set_text(text, message);
+    return text;
+}
+
 void djui_console_message_create(const char* message, enum ConsoleMessageLevel level) {
     if (sDjuiConsoleQueueMessages || !gDjuiConsole) {
         djui_console_message_queue(message, level);
@@ -142,7 +175,15 @@ void djui_console_message_create(const char* message, enum ConsoleMessageLevel l
 
     f32 maxTextWidth = gDjuiConsole->base.comp.width - gDjuiConsole->base.padding.left.value - gDjuiConsole->base.padding.right.value;
 
-    struct DjuiText* text = djui_text_create(cfBase, message);
+    struct DjuiText* text = NULL;
+    if (sDjuiConsoleMessages >= MAX_CONSOLE_MESSAGES) {
+        text = djui_console_message_reuse_oldest(message);
+    } else {
+        text = djui_text_create(cfBase, message);
+        sConsoleMessageChildren[(sConsoleMessageOldest + sDjuiConsoleMessages) % MAX_CONSOLE_MESSAGES] = cfBase->child;
+        sDjuiConsoleMessages++;
+    }
+
     struct DjuiBase* tBase = &text->base;
     djui_base_set_alignment(tBase, DJUI_HALIGN_LEFT, DJUI_VALIGN_BOTTOM);
     djui_base_set_size_type(tBase, DJUI_SVT_ABSOLUTE, DJUI_SVT_ABSOLUTE);
@@ -171,21 +212,6 @@ void djui_console_message_create(const char* message, enum ConsoleMessageLevel l
         cfBase->y.value -= heightAdjust;
         gDjuiConsole->scrollY -= heightAdjust;
     }
-
-    sDjuiConsoleMessages++;
-    if (sDjuiConsoleMessages >= MAX_CONSOLE_MESSAGES) {
-        if (cfBase->child) {
-            heightAdjust = cfBase->child->base->height.value + gDjuiConsole->flow->margin.value;
-            cfBase->height.value -= heightAdjust;
-            if (gDjuiConsole->scrolling && gDjuiConsole->scrollY != 0) {
-                cfBase->y.value += heightAdjust;
-                gDjuiConsole->scrollY += heightAdjust;
-            }
-        }
-
-        djui_base_destroy_one_child(cfBase);
-        sDjuiConsoleMessages--;
-    }
 }
 
 struct DjuiConsole* djui_console_create(void) {
@@ -223,6 +249,9 @@ struct DjuiConsole* djui_console_create(void) {
     cfBase->abandonAfterChildRenderFail = true;
     console->flow = flow;
 
+    sDjuiConsoleMessages = 0;
+    sConsoleMessageOldest = 0;
+
     gDjuiConsole = console;
 
     return console;
@@ -3,6 +3,9 @@
 #include "djui.h"
 #include "pc/pc_main.h"
 #include "pc/debug_context.h"
+#include "pc/gfx/gfx_pc.h"
+#include "game/object_list_processor.h"
+#include "game/camera_collision.h"
 
 #ifdef DEVELOPMENT
 
@@ -32,6 +35,11 @@ struct DjuiCtxEntry {
 struct DjuiCtxDisplay {
     struct DjuiCtxEntry topEntry;
     struct DjuiCtxEntry entries[CTX_MAX];
+    struct DjuiCtxEntry texCacheEntry;
+    struct DjuiCtxEntry drawEntry;
+    struct DjuiCtxEntry shaderEntry;
+    struct DjuiCtxEntry collisionEntry;
+    struct DjuiCtxEntry cameraEntry;
     struct DjuiBase base;
 };
 
@@ -74,6 +82,47 @@ void djui_ctx_display_update(void) {
         snprintf(timing, 32, "%05d", counterMs);
         djui_text_set_text(entry->timing, timing);
     }
+
+    // Texture cache hits/misses/evictions of the last frame
+    struct TextureCacheStats texStats = { 0 };
+    gfx_texture_cache_get_stats(&texStats);
+    struct DjuiCtxEntry *texEntry = &sCtxDisplay->texCacheEntry;
+    djui_text_set_text(texEntry->name, "TEX");
+    char texCounters[32];
+    snprintf(texCounters, 32, "%u/%u/%u", texStats.hits, texStats.misses, texStats.evictions);
+    djui_text_set_text(texEntry->timing, texCounters);
+
+    // Draw calls/state changes/skipped texture rebinds of the last frame
+    struct GfxDrawStats drawStats = { 0 };
+    gfx_get_draw_stats(&drawStats);
+    struct DjuiCtxEntry *drawEntry = &sCtxDisplay->drawEntry;
+    djui_text_set_text(drawEntry->name, "DRAW");
+    char drawCounters[32];
+    snprintf(drawCounters, 32, "%u/%u/%u", drawStats.draw_calls, drawStats.state_changes, drawStats.texture_rebinds_skipped);
+    djui_text_set_text(drawEntry->timing, drawCounters);
+
+    // New color combiners/compiled shaders of the last frame
+    struct DjuiCtxEntry *shaderEntry = &sCtxDisplay->shaderEntry;
+    djui_text_set_text(shaderEntry->name, "SHADER");
+    char shaderCounters[32];
+    snprintf(shaderCounters, 32, "%u/%u", drawStats.combiner_misses, drawStats.shader_compiles);
+    djui_text_set_text(shaderEntry->timing, shaderCounters);
+
+    // Floor/wall/ceiling queries of the last frame, including interpolated frames
+    struct DjuiCtxEntry *collisionEntry = &sCtxDisplay->collisionEntry;
+    djui_text_set_text(collisionEntry->name, "COLL");
+    char collisionCounters[32];
+    snprintf(collisionCounters, 32, "%d/%d/%d", gNumCalls.floor, gNumCalls.wall, gNumCalls.ceil);
+    djui_text_set_text(collisionEntry->timing, collisionCounters);
+
+    // Camera collision queries/memoized queries/microseconds of the last camera update
+    struct CameraCollisionStats cameraStats = { 0 };
+    camera_collision_get_stats(&cameraStats);
+    struct DjuiCtxEntry *cameraEntry = &sCtxDisplay->cameraEntry;
+    djui_text_set_text(cameraEntry->name, "CAM");
+    char cameraCounters[32];
+    snprintf(cameraCounters, 32, "%u/%u/%d", cameraStats.queries, cameraStats.memoHits, (s32)(cameraStats.time * 1000000.0));
+    djui_text_set_text(cameraEntry->timing, cameraCounters);
 #endif
 }
 
@@ -113,7 +162,7 @@ void djui_ctx_display_create(void) {
     struct DjuiCtxDisplay *ctxDisplay = calloc(1, sizeof(struct DjuiCtxDisplay));
     struct DjuiBase *base = &ctxDisplay->base;
     djui_base_init(NULL, base, NULL, djui_ctx_display_on_destroy);
-    djui_base_set_size(base, 220.0f, 39.0f + ((CTX_MAX - 2) * 26.0f));
+    djui_base_set_size(base, 220.0f, 39.0f + ((CTX_MAX + 3) * 26.0f));
     djui_base_set_color(base, 0, 0, 0, 240);
     djui_base_set_border_color(base, 0, 0, 0, 200);
     djui_base_set_border_width(base, 4);
@@ -130,6 +179,20 @@ void djui_ctx_display_create(void) {
             djui_ctx_display_initialize_entry(base, &ctxDisplay->entries[i], offset);
             offset += 22.0;
         }
+
+        djui_ctx_display_initialize_entry(base, &ctxDisplay->texCacheEntry, offset);
+        offset += 22.0;
+
+        djui_ctx_display_initialize_entry(base, &ctxDisplay->drawEntry, offset);
+        offset += 22.0;
+
+        djui_ctx_display_initialize_entry(base, &ctxDisplay->shaderEntry, offset);
+        offset += 22.0;
+
+        djui_ctx_display_initialize_entry(base, &ctxDisplay->collisionEntry, offset);
+        offset += 22.0;
+
+        djui_ctx_display_initialize_entry(base, &ctxDisplay->cameraEntry, offset);
     }
 
     sCtxDisplay = ctxDisplay;
@@ -30,6 +30,8 @@ static enum DjuiFontType sFont = FONT_NORMAL;
 static struct HudUtilsRotation sRotation = { 0, 0, 0, 0, 0, 0 };
 static struct DjuiColor sColor = { 255, 255, 255, 255 };
 static struct DjuiColor sRefColor = { 255, 255, 255, 255 };
+static struct DjuiColor sTextOutlineColor = { 0, 0, 0, 255 };
+static f32 sTextOutlineSize = 0;
 static bool sLegacy = false;
 
 f32 gDjuiHudUtilsZ = 0;
@@ -209,6 +211,18 @@ void djui_hud_set_color(u8 r, u8 g, u8 b, u8 a) {
     gDPSetEnvColor(gDisplayListHead++, r, g, b, a);
 }
 
+void djui_hud_set_text_outline(u8 r, u8 g, u8 b, u8 a, f32 size) {
+    sTextOutlineColor.r = r;
+    sTextOutlineColor.g = g;
+    sTextOutlineColor.b = b;
+    sTextOutlineColor.a = a;
+    sTextOutlineSize = (size > 0) ? size : 0;
+}
+
+void djui_hud_reset_text_outline(void) {
+    sTextOutlineSize = 0;
+}
+
 void djui_hud_reset_color(void) {
     if (sColorAltered) {
         sColor.r = 255;
@@ -315,6 +329,44 @@ f32 djui_hud_measure_text(const char* message) {
     return width * font->defaultFontScale;
 }
 
+static void djui_hud_print_text_line(const struct DjuiFont* font, const char* message) {
+    f32 addX = 0;
+    char* c = (char*)message;
+    while (*c != '\0') {
+        f32 charWidth = font->char_width(c);
+
+        if (*c == '\n' && *c == ' ') {
+            addX += charWidth;
+            c++;
+            continue;
+        }
+
+        // render
+        font->render_char(c);
+        create_dl_translation_matrix(DJUI_MTX_NOPUSH, charWidth + addX, 0, 0);
+        addX = 0;
+
+        c = djui_unicode_next_char(c);
+    }
+}
+
+static void djui_hud_print_text_glyphs(const struct DjuiFont* font, const char* message) {
+    if (sTextOutlineSize > 0) {
+        // the outline is drawn within the text's own matrix, so it is scaled and interpolated with it
+        static const s8 sOutlineDirs[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+        f32 offset = sTextOutlineSize / font->defaultFontScale;
+        gDPSetEnvColor(gDisplayListHead++, sTextOutlineColor.r, sTextOutlineColor.g, sTextOutlineColor.b, sTextOutlineColor.a);
+        for (s32 i = 0; i < 4; i++) {
+            create_dl_translation_matrix(DJUI_MTX_PUSH, sOutlineDirs[i][0] * offset, sOutlineDirs[i][1] * offset, 0);
+            djui_hud_print_text_line(font, message);
+            gSPPopMatrix(gDisplayListHead++, G_MTX_MODELVIEW);
+        }
+        gDPSetEnvColor(gDisplayListHead++, sColor.r, sColor.g, sColor.b, sColor.a);
+    }
+
+    djui_hud_print_text_line(font, message);
+}
+
 void djui_hud_print_text(const char* message, f32 x, f32 y, f32 scale) {
     if (message == NULL) { return; }
     gDjuiHudUtilsZ += 0.01f;
@@ -341,24 +393,7 @@ void djui_hud_print_text(const char* message, f32 x, f32 y, f32 scale) {
     create_dl_scale_matrix(DJUI_MTX_NOPUSH, translatedFontSize, translatedFontSize, 1.0f);
 
     // render the line
-    f32 addX = 0;
-    char* c = (char*)message;
-    while (*c != '\0') {
-        f32 charWidth = font->char_width(c);
-
-        if (*c == '\n' && *c == ' ') {
-            addX += charWidth;
-            c++;
-            continue;
-        }
-
-        // render
-        font->render_char(c);
-        create_dl_translation_matrix(DJUI_MTX_NOPUSH, charWidth + addX, 0, 0);
-        addX = 0;
-
-        c = djui_unicode_next_char(c);
-    }
+    djui_hud_print_text_glyphs(font, message);
 
     // pop
     gSPPopMatrix(gDisplayListHead++, G_MTX_MODELVIEW);
@@ -396,24 +431,7 @@ void djui_hud_print_text_interpolated(const char* message, f32 prevX, f32 prevY,
     create_dl_scale_matrix(DJUI_MTX_NOPUSH, translatedFontSize, translatedFontSize, 1.0f);
 
     // render the line
-    f32 addX = 0;
-    char* c = (char*)message;
-    while (*c != '\0') {
-        f32 charWidth = font->char_width(c);
-
-        if (*c == '\n' && *c == ' ') {
-            addX += charWidth;
-            c++;
-            continue;
-        }
-
-        // render
-        font->render_char(c);
-        create_dl_translation_matrix(DJUI_MTX_NOPUSH, charWidth + addX, 0, 0);
-        addX = 0;
-
-        c = djui_unicode_next_char(c);
-    }
+    djui_hud_print_text_glyphs(font, message);
 
     // pop
     gSPPopMatrix(gDisplayListHead++, G_MTX_MODELVIEW);
@@ -72,6 +72,10 @@ struct DjuiColor* djui_hud_get_color(void);
 void djui_hud_set_color(u8 r, u8 g, u8 b, u8 a);
 /* |description|Resets the current DJUI HUD color|descriptionEnd| */
 void djui_hud_reset_color(void);
+/* |description|Sets the outline drawn around DJUI HUD text, in the same pass as the text. The `size` is in HUD units at a text scale of 1, a size of 0 disables the outline|descriptionEnd| */
+void djui_hud_set_text_outline(u8 r, u8 g, u8 b, u8 a, f32 size);
+/* |description|Disables the outline drawn around DJUI HUD text|descriptionEnd| */
+void djui_hud_reset_text_outline(void);
 /* |description|Gets the current DJUI HUD rotation|descriptionEnd| */
 struct HudUtilsRotation* djui_hud_get_rotation(void);
 /* |description|Sets the current DJUI HUD rotation|descriptionEnd| */
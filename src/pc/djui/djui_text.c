@@ -28,13 +28,16 @@ void djui_text_set_text(struct DjuiText* text, const char* message) {
     u16 messageLen = strlen(message);
     text->message = calloc((messageLen + 1), sizeof(char));
     memcpy(text->message, message, sizeof(char) * (messageLen + 1));
+    text->layout.valid = false;
 }
 
 void djui_text_set_font(struct DjuiText* text, const struct DjuiFont* font) {
+    if (text->font != font) { text->layout.valid = false; }
     text->font = font;
 }
 
 void djui_text_set_font_scale(struct DjuiText* text, f32 fontScale) {
+    if (text->fontScale != fontScale) { text->layout.valid = false; }
     text->fontScale = fontScale;
 }
 
@@ -176,38 +179,60 @@ static void djui_text_read_line(struct DjuiText* text, char** message, f32* line
     *message = c;
 }
 
-int djui_text_count_lines(struct DjuiText* text, u16 maxLines) {
-    struct DjuiBaseRect* comp = &text->base.comp;
+static struct DjuiTextLayout* djui_text_get_layout(struct DjuiText* text, u16 maxLines) {
+    struct DjuiTextLayout* layout = &text->layout;
+    f32 maxLineWidth = text->base.comp.width / ((f32)text->fontScale);
+
+    if (layout->valid
+        && layout->maxLines == maxLines
+        && layout->maxLineWidth == maxLineWidth
+        && layout->font == text->font
+        && layout->exCoopTheme == configExCoopTheme) {
+        return layout;
+    }
+
+    layout->lineCount = 0;
+    layout->maxLines = maxLines;
+    layout->maxLineWidth = maxLineWidth;
+    layout->font = text->font;
+    layout->exCoopTheme = configExCoopTheme;
+    layout->valid = true;
+
     char* c = text->message;
-    f32 maxLineWidth = comp->width / ((f32)text->fontScale);
-    u16 lineCount = 0;
     while (*c != '\0') {
-        bool onLastLine = lineCount + 1 >= maxLines;
+        bool onLastLine = layout->lineCount + 1 >= maxLines;
+        char* c1 = c;
         f32 lineWidth;
         bool ellipses;
         djui_text_read_line(text, &c, &lineWidth, maxLineWidth, onLastLine, &ellipses);
-        lineCount++;
+
+        if (layout->lineCount >= layout->lineCapacity) {
+            u16 capacity = (layout->lineCapacity == 0) ? 4 : (layout->lineCapacity * 2);
+            struct DjuiTextLine* lines = realloc(layout->lines, capacity * sizeof(struct DjuiTextLine));
+            if (lines == NULL) { break; }
+            layout->lines = lines;
+            layout->lineCapacity = capacity;
+        }
+
+        struct DjuiTextLine* line = &layout->lines[layout->lineCount++];
+        line->start = c1 - text->message;
+        line->end = c - text->message;
+        line->width = lineWidth;
         if (onLastLine) { break; }
     }
-    return lineCount;
+
+    return layout;
 }
 
-f32 djui_text_find_width(struct DjuiText* text, u16 maxLines) {
-    struct DjuiBaseRect* comp = &text->base.comp;
-    char* c = text->message;
-    f32 maxLineWidth = comp->width / ((f32)text->fontScale);
-    u16 lineCount = 0;
+int djui_text_count_lines(struct DjuiText* text, u16 maxLines) {
+    return djui_text_get_layout(text, maxLines)->lineCount;
+}
 
+f32 djui_text_find_width(struct DjuiText* text, u16 maxLines) {
+    struct DjuiTextLayout* layout = djui_text_get_layout(text, maxLines);
     f32 largestWidth = 0;
-
-    while (*c != '\0') {
-        bool onLastLine = lineCount + 1 >= maxLines;
-        f32 lineWidth;
-        bool ellipses;
-        djui_text_read_line(text, &c, &lineWidth, maxLineWidth, onLastLine, &ellipses);
-        largestWidth = fmax(largestWidth, lineWidth);
-        lineCount++;
-        if (onLastLine) { break; }
+    for (u16 i = 0; i < layout->lineCount; i++) {
+        largestWidth = fmax(largestWidth, layout->lines[i].width);
     }
     return largestWidth * text->fontScale;
 }
@@ -359,8 +384,8 @@ static bool djui_text_render(struct DjuiBase* base) {
 
     // count lines
     u16 maxLines = comp->height / ((f32)text->font->lineHeight * text->fontScale);
-    f32 maxLineWidth = comp->width / ((f32)text->fontScale);
-    u16 lineCount = djui_text_count_lines(text, maxLines);
+    struct DjuiTextLayout* layout = djui_text_get_layout(text, maxLines);
+    u16 lineCount = layout->lineCount;
 
     // do vertical alignment
     f32 vOffset = 0;
@@ -374,18 +399,9 @@ static bool djui_text_render(struct DjuiBase* base) {
     djui_text_translate(0, vOffset);
 
     // render lines
-    char* c1 = text->message;
-    char* c2 = c1;
-    f32 lineWidth;
-    u16 lineIndex = 0;
-    bool ellipses = false;
-    while (*c1 != '\0') {
-        bool onLastLine = lineIndex + 1 >= maxLines;
-        djui_text_read_line(text, &c2, &lineWidth, maxLineWidth, onLastLine, &ellipses);
-        djui_text_render_line(text, c1, c2, lineWidth, ellipses);
-        c1 = c2;
-        lineIndex++;
-        if (onLastLine) { break; }
+    for (u16 i = 0; i < lineCount; i++) {
+        struct DjuiTextLine* line = &layout->lines[i];
+        djui_text_render_line(text, text->message + line->start, text->message + line->end, line->width, false);
     }
 
     gSPPopMatrix(gDisplayListHead++, G_MTX_MODELVIEW);
@@ -396,6 +412,7 @@ static bool djui_text_render(struct DjuiBase* base) {
 static void djui_text_destroy(struct DjuiBase* base) {
     struct DjuiText* text = (struct DjuiText*)base;
     free(text->message);
+    free(text->layout.lines);
     free(text);
 }
 
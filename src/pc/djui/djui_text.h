@@ -1,6 +1,24 @@
 #pragma once
 #include "djui.h"
 
+struct DjuiTextLine {
+    u32 start;
+    u32 end;
+    f32 width;
+};
+
+// Line breaks are only measured again when something they depend on changes
+struct DjuiTextLayout {
+    struct DjuiTextLine* lines;
+    u16 lineCount;
+    u16 lineCapacity;
+    u16 maxLines;
+    f32 maxLineWidth;
+    const struct DjuiFont* font;
+    bool exCoopTheme;
+    bool valid;
+};
+
 struct DjuiText {
     struct DjuiBase base;
     char* message;
@@ -9,6 +27,7 @@ struct DjuiText {
     struct DjuiColor dropShadow;
     enum DjuiHAlign textHAlign;
     enum DjuiVAlign textVAlign;
+    struct DjuiTextLayout layout;
 };
 
 void djui_text_set_text(struct DjuiText* text, const char* message);
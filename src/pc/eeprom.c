@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "eeprom.h"
+#include "thread.h"
+#include "fs/fs.h"
+#include "debuglog.h"
+
+static u8 sEepromImage[EEPROM_FILE_SIZE] = { 0 };
+static bool sEepromImageLoaded = false;
+static bool sEepromImageValid = false;
+
+// Bumped by every write, the writer is given the image when they differ
+static u32 sEepromGeneration = 0;
+static u32 sEepromFlushedGeneration = 0;
+
+// Only touched by the writer thread while it runs
+static struct ThreadHandle sEepromWriterThread = { 0 };
+static u8 sEepromWriterImage[EEPROM_FILE_SIZE] = { 0 };
+static char sEepromWriterPath[SYS_MAX_PATH] = "";
+static char sEepromWriterTempPath[SYS_MAX_PATH] = "";
+static bool sEepromWriterBusy = false;
+static bool sEepromWriterFailed = false;
+
+static u32 sEepromDiskWrites = 0;
+
+static void eeprom_load_image(void) {
+    if (sEepromImageLoaded) { return; }
+    sEepromImageLoaded = true;
+
+    fs_file_t *fp = fs_open(SAVE_FILENAME);
+    if (fp == NULL) { return; }
+    sEepromImageValid = (fs_read(fp, sEepromImage, EEPROM_FILE_SIZE) == EEPROM_FILE_SIZE);
+    fs_close(fp);
+
+    if (!sEepromImageValid) {
+        memset(sEepromImage, 0, EEPROM_FILE_SIZE);
+    }
+}
+
+// Write the whole file next to the save, then replace the save with it,
+// so that the save is never left half written
+static bool eeprom_write_to_disk(void) {
+    FILE *fp = fopen(sEepromWriterTempPath, "wb");
+    if (fp == NULL) { return false; }
+
+    bool written = (fwrite(sEepromWriterImage, 1, EEPROM_FILE_SIZE, fp) == EEPROM_FILE_SIZE);
+    written = (fclose(fp) == 0) && written;
+    if (!written) {
+        remove(sEepromWriterTempPath);
+        return false;
+    }
+
+    return fs_sys_replace_file(sEepromWriterTempPath, sEepromWriterPath);
+}
+
+static void *eeprom_writer_thread(UNUSED void *arg) {
+    sEepromWriterFailed = !eeprom_write_to_disk();
+    __atomic_store_n(&sEepromWriterBusy, false, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+s32 eeprom_read(u8 address, u8 *buffer, int nbytes) {
+    eeprom_load_image();
+    if (!sEepromImageValid) { return -1; }
+    memcpy(buffer, sEepromImage + address * 8, nbytes);
+    return 0;
+}
+
+s32 eeprom_write(u8 address, u8 *buffer, int nbytes) {
+    eeprom_load_image();
+    memcpy(sEepromImage + address * 8, buffer, nbytes);
+    sEepromImageValid = true;
+    sEepromGeneration++;
+    return 0;
+}
+
+/**
+ * Write the save to disk if it changed since the last flush.
+ * Unless waiting, the write is done on a writer thread, and is skipped
+ * until the next call when the previous write is still running.
+ */
+void eeprom_flush(bool wait) {
+    if (sEepromWriterThread.state == RUNNING) {
+        if (!wait && __atomic_load_n(&sEepromWriterBusy, __ATOMIC_ACQUIRE)) { return; }
+        join_thread(&sEepromWriterThread);
+        if (sEepromWriterFailed) {
+            LOG_ERROR("Failed to write save file '%s'", sEepromWriterPath);
+            sEepromWriterFailed = false;
+        }
+    }
+
+    if (sEepromFlushedGeneration == sEepromGeneration) { return; }
+    sEepromFlushedGeneration = sEepromGeneration;
+
+    const char *path = fs_get_write_path(SAVE_FILENAME);
+    if (path == NULL) { return; }
+    snprintf(sEepromWriterPath, SYS_MAX_PATH, "%s", path);
+    snprintf(sEepromWriterTempPath, SYS_MAX_PATH, "%s.tmp", path);
+    memcpy(sEepromWriterImage, sEepromImage, EEPROM_FILE_SIZE);
+    sEepromDiskWrites++;
+
+    if (!wait) {
+        __atomic_store_n(&sEepromWriterBusy, true, __ATOMIC_RELEASE);
+        if (init_thread(&sEepromWriterThread, eeprom_writer_thread, NULL, NULL, 0) == 0) {
+            return;
+        }
+        sEepromWriterThread.state = INVALID;
+        __atomic_store_n(&sEepromWriterBusy, false, __ATOMIC_RELEASE);
+    }
+
+    // write it right away when waiting, or when the writer thread couldn't start
+    if (!eeprom_write_to_disk()) {
+        LOG_ERROR("Failed to write save file '%s'", sEepromWriterPath);
+    }
+}
+
+u32 eeprom_get_disk_writes(void) {
+    return sEepromDiskWrites;
+}
@@ -0,0 +1,17 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include <stdbool.h>
+#include <PR/ultratypes.h>
+
+#define EEPROM_FILE_SIZE 512
+
+// The save file is kept in memory. Writes only update it, all of the writes made during
+// a frame are written to disk together by eeprom_flush(), on a writer thread.
+
+s32 eeprom_read(u8 address, u8 *buffer, int nbytes);
+s32 eeprom_write(u8 address, u8 *buffer, int nbytes);
+void eeprom_flush(bool wait);
+u32 eeprom_get_disk_writes(void);
+
+#endif // EEPROM_H
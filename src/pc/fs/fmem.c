@@ -151,6 +151,10 @@ int f_flush(FILE *f) {
     return 0;
 }
 
+bool f_in_memory(const char *filename) {
+    return f_get_file_from_name(filename) != NULL;
+}
+
 void f_shutdown() {
     for (file_node_t *node = sMemoryFiles; node;) {
         if (node->file.data) {
@@ -2,6 +2,7 @@
 #define FMEM_H
 
 #include <stdio.h>
+#include <stdbool.h>
 
 FILE   *f_open_r   (const char *filename);
 FILE   *f_open_w   (const char *filename);
@@ -14,5 +15,6 @@ long    f_tell     (FILE *f);
 void    f_rewind   (FILE *f);
 int     f_flush    (FILE *f);
 void    f_shutdown ();
+bool    f_in_memory(const char *filename);
 
 #endif
@@ -10,6 +10,7 @@
 #endif
 #include <ctype.h>
 #ifdef _WIN32
+#include <windows.h>
 #include <direct.h>
 #include <fileapi.h>
 #endif
@@ -401,3 +402,11 @@ bool fs_sys_rmdir(const char *name) {
     return rmdir(name) == 0;
 #endif
 }
+
+bool fs_sys_replace_file(const char *src, const char *dst) {
+#ifdef _WIN32
+    return MoveFileExA(src, dst, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return rename(src, dst) == 0;
+#endif
+}
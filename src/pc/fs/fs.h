@@ -108,5 +108,6 @@ bool fs_sys_dir_exists(const char *name);
 bool fs_sys_dir_is_empty(const char *name);
 bool fs_sys_mkdir(const char *name); // creates with 0777 by default
 bool fs_sys_rmdir(const char *name); // removes an empty directory
+bool fs_sys_replace_file(const char *src, const char *dst); // renames src to dst, replacing dst
 
 #endif // _SM64_FS_H_
@@ -19,13 +19,12 @@
 #define HALF_SCREEN_WIDTH (SCREEN_WIDTH / 2)
 #define HALF_SCREEN_HEIGHT (SCREEN_HEIGHT / 2)
 
-#define MAX_BUFFERED 256
+#define MAX_BUFFERED 1024
 #define MAX_MATRIX_STACK_SIZE 11
 #define MAX_LIGHTS 18
 #define MAX_VERTICES 64
 #define MAX_CACHED_TEXTURES 4096 // for preloading purposes
 
-#define HASH_SHIFT 0
 #define HASHMAP_LEN (MAX_CACHED_TEXTURES * 2)
 #define HASH_MASK (HASHMAP_LEN - 1)
 
@@ -78,12 +77,30 @@ struct TextureHashmapNode {
     uint8_t fmt, siz;
     uint8_t cms, cmt;
     bool linear_filter;
+    bool referenced; // second chance bit for the clock eviction
+};
+
+struct TextureCacheStats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+};
+
+struct GfxDrawStats {
+    uint32_t draw_calls;
+    uint32_t triangles;
+    uint32_t state_changes;
+    uint32_t texture_rebinds_skipped;
+    uint32_t combiner_misses;
+    uint32_t shader_compiles;
 };
 
 struct TextureCache {
     struct TextureHashmapNode *hashmap[HASHMAP_LEN];
     struct TextureHashmapNode pool[MAX_CACHED_TEXTURES];
     uint32_t pool_pos;
+    uint32_t clock_hand;
+    struct TextureCacheStats stats; // reset every frame
 };
 
 extern struct GfxDimensions gfx_current_dimensions;
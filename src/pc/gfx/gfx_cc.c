@@ -1,9 +1,31 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include "PR/gbi.h"
 #include "gfx_cc.h"
 #include "gfx_pc.h"
+#include "pc/fs/fs.h"
+#include "pc/debuglog.h"
+
+// Every combine mode that was built is appended to this file, and they're all built again
+// when the renderer starts so that their shaders aren't compiled in the middle of a frame.
+// Shaders are generated from the combine mode, so bump the version when the generators change.
+#define CC_CACHE_FILENAME "shader_cache.bin"
+#define CC_CACHE_MAGIC 0x43434348
+#define CC_CACHE_VERSION 1
+#define CC_CACHE_MAX_ENTRIES 1024
+
+struct CCCacheEntry {
+    uint32_t rgb1;
+    uint32_t alpha1;
+    uint32_t rgb2;
+    uint32_t alpha2;
+    uint32_t flags;
+    uint32_t check;
+};
 
 static u8 sAllowCCPrint = 1;
+static bool sCCCacheRecord = false;
+static u32 sCCCacheEntries = 0;
 
 bool gfx_cm_uses_second_texture(struct CombineMode* cm) {
     for (int i = 0; i < 16; i++) {
@@ -77,8 +99,88 @@ void gfx_cc_print(UNUSED struct ColorCombiner *cc) {
 #endif*/
 }
 
+static uint32_t gfx_cc_cache_check(struct CCCacheEntry* entry) {
+    return (entry->rgb1 ^ (entry->alpha1 << 7) ^ (entry->rgb2 << 13) ^ (entry->alpha2 << 19) ^ entry->flags) + CC_CACHE_MAGIC;
+}
+
+static FILE* gfx_cc_cache_reset(void) {
+    sCCCacheEntries = 0;
+    FILE* fp = fopen(fs_get_write_path(CC_CACHE_FILENAME), "wb");
+    if (fp == NULL) { return NULL; }
+
+    uint32_t header[2] = { CC_CACHE_MAGIC, CC_CACHE_VERSION };
+    fwrite(header, sizeof(uint32_t), 2, fp);
+    return fp;
+}
+
+static void gfx_cc_cache_load(void) {
+    FILE* fp = fopen(fs_get_write_path(CC_CACHE_FILENAME), "rb");
+    if (fp == NULL) { return; }
+
+    uint32_t header[2] = { 0 };
+    if (fread(header, sizeof(uint32_t), 2, fp) != 2 || header[0] != CC_CACHE_MAGIC || header[1] != CC_CACHE_VERSION) {
+        fclose(fp);
+        LOG_INFO("Shader cache is outdated, discarding it");
+        fp = gfx_cc_cache_reset();
+        if (fp != NULL) { fclose(fp); }
+        return;
+    }
+
+    struct CCCacheEntry* entries = calloc(CC_CACHE_MAX_ENTRIES, sizeof(struct CCCacheEntry));
+    if (entries == NULL) { fclose(fp); return; }
+
+    u32 count = 0;
+    while (count < CC_CACHE_MAX_ENTRIES && fread(&entries[count], sizeof(struct CCCacheEntry), 1, fp) == 1) {
+        if (entries[count].check != gfx_cc_cache_check(&entries[count])) { break; }
+        count++;
+    }
+
+    // entries are appended to the end of the file, so drop a damaged or truncated tail
+    fseek(fp, 0, SEEK_END);
+    bool damaged = (ftell(fp) != (long)(sizeof(header) + count * sizeof(struct CCCacheEntry)));
+    fclose(fp);
+    if (damaged) {
+        LOG_INFO("Shader cache is damaged, keeping %u entries", count);
+        fp = gfx_cc_cache_reset();
+        if (fp != NULL) {
+            fwrite(entries, sizeof(struct CCCacheEntry), count, fp);
+            fclose(fp);
+        }
+    }
+
+    for (u32 i = 0; i < count; i++) {
+        gfx_pc_precomp_shader(entries[i].rgb1, entries[i].alpha1, entries[i].rgb2, entries[i].alpha2, entries[i].flags);
+    }
+    sCCCacheEntries = count;
+    free(entries);
+
+    LOG_INFO("Built %u cached shaders", count);
+}
+
+void gfx_cc_cache_record(struct CombineMode* cm) {
+    if (!sCCCacheRecord || sCCCacheEntries >= CC_CACHE_MAX_ENTRIES) { return; }
+
+    FILE* fp = (sCCCacheEntries == 0)
+        ? gfx_cc_cache_reset()
+        : fopen(fs_get_write_path(CC_CACHE_FILENAME), "ab");
+    if (fp == NULL) { return; }
+
+    struct CCCacheEntry entry = {
+        .rgb1 = cm->rgb1,
+        .alpha1 = cm->alpha1,
+        .rgb2 = cm->rgb2,
+        .alpha2 = cm->alpha2,
+        .flags = cm->flags,
+    };
+    entry.check = gfx_cc_cache_check(&entry);
+    fwrite(&entry, sizeof(struct CCCacheEntry), 1, fp);
+    fclose(fp);
+    sCCCacheEntries++;
+}
+
 void gfx_cc_precomp(void) {
     sAllowCCPrint = 0;
+    sCCCacheRecord = false;
 
     gfx_pc_precomp_shader(0x00030001, 0x02000000, 0x000a0004, 0x0a000b0b, 0x00000011);    // 741f2ad014006ca1
     gfx_pc_precomp_shader(0x00040001, 0x00010005, 0x00040002, 0x0b020b05, 0x00000001);    // 110404410ba7b38b
@@ -118,7 +220,10 @@ void gfx_cc_precomp(void) {
     gfx_pc_precomp_shader(0x04060401, 0x05000000, 0x04060402, 0x05000b0b, 0x00000009);    // 1d970841b086b2ee
     gfx_pc_precomp_shader(0x00040001, 0x00040001, 0x00040002, 0x0b040b02, 0x00000009);    // 110404410c0ab30f
 
+    gfx_cc_cache_load();
+
     sAllowCCPrint = 1;
+    sCCCacheRecord = true;
 }
 
 
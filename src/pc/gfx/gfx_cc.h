@@ -86,7 +86,9 @@ struct CombineMode {
 #pragma pack()
 
 #define SHADER_CMD_LENGTH 16
-#define CC_MAX_SHADERS 64
+// Combiners and shader programs are kept in hashmaps of this many buckets, with no cap on their count
+#define CC_HASHMAP_LEN 256
+#define CC_HASHMAP_INDEX(hash) ((uint32_t)((hash) ^ ((hash) >> 32)) & (CC_HASHMAP_LEN - 1))
 
 struct ColorCombiner {
     struct CombineMode cm;
@@ -110,6 +112,7 @@ bool gfx_cm_uses_second_texture(struct CombineMode* cm);
 void gfx_cc_get_features(struct ColorCombiner* cc, struct CCFeatures *cc_features);
 void gfx_cc_print(struct ColorCombiner *cc);
 void gfx_cc_precomp(void);
+void gfx_cc_cache_record(struct CombineMode* cm);
 uint32_t color_comb_rgb(uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint8_t cycle);
 uint32_t color_comb_alpha(uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint8_t cycle);
 
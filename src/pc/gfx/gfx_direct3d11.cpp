@@ -2,6 +2,7 @@
 
 #include <cstdio>
 #include <vector>
+#include <unordered_map>
 #include <cmath>
 
 #include <windows.h>
@@ -30,6 +31,7 @@ extern "C" {
 #include "gfx_dxgi.h"
 
 #include "gfx_screen_config.h"
+#include "gfx.h"
 
 #define THREE_POINT_FILTERING 0
 #define DEBUG_D3D 0
@@ -103,9 +105,8 @@ static struct {
     PerFrameCB per_frame_cb_data;
     PerDrawCB per_draw_cb_data;
 
-    struct ShaderProgramD3D11 shader_program_pool[CC_MAX_SHADERS];
-    uint8_t shader_program_pool_size;
-    uint8_t shader_program_pool_index;
+    // programs are never released, combiners keep pointing at them
+    std::unordered_map<uint64_t, struct ShaderProgramD3D11 *> shader_programs;
 
     std::vector<struct TextureData> textures;
     int current_tile;
@@ -272,7 +273,7 @@ static void gfx_d3d11_init(void) {
     ZeroMemory(&vertex_buffer_desc, sizeof(D3D11_BUFFER_DESC));
 
     vertex_buffer_desc.Usage = D3D11_USAGE_DYNAMIC;
-    vertex_buffer_desc.ByteWidth = 256 * 26 * 3 * sizeof(float); // Same as buf_vbo size in gfx_pc
+    vertex_buffer_desc.ByteWidth = MAX_BUFFERED * 26 * 3 * sizeof(float); // Same as buf_vbo size in gfx_pc
     vertex_buffer_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
     vertex_buffer_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
     vertex_buffer_desc.MiscFlags = 0;
@@ -356,9 +357,8 @@ static struct ShaderProgram *gfx_d3d11_create_and_load_new_shader(struct ColorCo
         throw hr;
     }
 
-    struct ShaderProgramD3D11 *prg = &d3d.shader_program_pool[d3d.shader_program_pool_index];
-    d3d.shader_program_pool_index = (d3d.shader_program_pool_index + 1) % CC_MAX_SHADERS;
-    if (d3d.shader_program_pool_size < CC_MAX_SHADERS) { d3d.shader_program_pool_size++; }
+    struct ShaderProgramD3D11 *prg = new ShaderProgramD3D11();
+    d3d.shader_programs[cc->hash] = prg;
 
     ThrowIfFailed(d3d.device->CreateVertexShader(vs->GetBufferPointer(), vs->GetBufferSize(), nullptr, prg->vertex_shader.GetAddressOf()));
     ThrowIfFailed(d3d.device->CreatePixelShader(ps->GetBufferPointer(), ps->GetBufferSize(), nullptr, prg->pixel_shader.GetAddressOf()));
@@ -417,10 +417,9 @@ static struct ShaderProgram *gfx_d3d11_create_and_load_new_shader(struct ColorCo
 }
 
 static struct ShaderProgram *gfx_d3d11_lookup_shader(struct ColorCombiner* cc) {
-    for (size_t i = 0; i < d3d.shader_program_pool_size; i++) {
-        if (d3d.shader_program_pool[i].hash == cc->hash) {
-            return (struct ShaderProgram *)&d3d.shader_program_pool[i];
-        }
+    auto it = d3d.shader_programs.find(cc->hash);
+    if (it != d3d.shader_programs.end()) {
+        return (struct ShaderProgram *)it->second;
     }
     return nullptr;
 }
@@ -55,6 +55,7 @@ struct ShaderProgram {
     uint8_t num_attribs;
     bool used_noise;
     bool used_lightmap;
+    struct ShaderProgram *next;
 };
 
 struct GLTexture {
@@ -63,9 +64,7 @@ struct GLTexture {
     bool filter;
 };
 
-static struct ShaderProgram shader_program_pool[CC_MAX_SHADERS];
-static uint8_t shader_program_pool_size = 0;
-static uint8_t shader_program_pool_index = 0;
+static struct ShaderProgram *shader_program_hashmap[CC_HASHMAP_LEN] = { 0 };
 static GLuint opengl_vbo;
 static GLuint opengl_vao;
 
@@ -488,9 +487,12 @@ static struct ShaderProgram *gfx_opengl_create_and_load_new_shader(struct ColorC
 
     size_t cnt = 0;
 
-    struct ShaderProgram *prg = &shader_program_pool[shader_program_pool_index];
-    shader_program_pool_index = (shader_program_pool_index + 1) % CC_MAX_SHADERS;
-    if (shader_program_pool_size < CC_MAX_SHADERS) { shader_program_pool_size++; }
+    // programs are never deleted, combiners keep pointing at them
+    struct ShaderProgram *prg = calloc(1, sizeof(struct ShaderProgram));
+    if (!prg) sys_fatal("out of memory allocating shader program");
+    uint32_t index = CC_HASHMAP_INDEX(cc->hash);
+    prg->next = shader_program_hashmap[index];
+    shader_program_hashmap[index] = prg;
 
     prg->attrib_locations[cnt] = glGetAttribLocation(shader_program, "aVtxPos");
     prg->attrib_sizes[cnt] = 4;
@@ -565,9 +567,9 @@ static struct ShaderProgram *gfx_opengl_create_and_load_new_shader(struct ColorC
 }
 
 static struct ShaderProgram *gfx_opengl_lookup_shader(struct ColorCombiner* cc) {
-    for (size_t i = 0; i < shader_program_pool_size; i++) {
-        if (shader_program_pool[i].hash == cc->hash) {
-            return &shader_program_pool[i];
+    for (struct ShaderProgram *prg = shader_program_hashmap[CC_HASHMAP_INDEX(cc->hash)]; prg != NULL; prg = prg->next) {
+        if (prg->hash == cc->hash) {
+            return prg;
         }
     }
     return NULL;
@@ -56,6 +56,7 @@ struct ShaderProgram {
     bool texture_used[2];
     int texture_ord[2];
     int num_inputs;
+    struct ShaderProgram *next;
 };
 
 struct SamplerState {
@@ -66,8 +67,7 @@ struct SamplerState {
     GLuint tex;
 };
 
-static struct ShaderProgram shader_program_pool[64];
-static uint8_t shader_program_pool_size;
+static struct ShaderProgram *shader_program_hashmap[CC_HASHMAP_LEN];
 static struct ShaderProgram *cur_shader = NULL;
 
 static struct SamplerState tmu_state[2];
@@ -247,7 +247,11 @@ static void gfx_opengl_load_shader(struct ShaderProgram *new_prg) {
 }
 
 static struct ShaderProgram *gfx_opengl_create_and_load_new_shader(struct ColorCombiner* cc) {
-    struct ShaderProgram *prg = &shader_program_pool[shader_program_pool_size++];
+    struct ShaderProgram *prg = calloc(1, sizeof(struct ShaderProgram));
+    if (!prg) sys_fatal("out of memory allocating shader program");
+    uint32_t index = CC_HASHMAP_INDEX(cc->hash);
+    prg->next = shader_program_hashmap[index];
+    shader_program_hashmap[index] = prg;
 
     struct CCFeatures ccf = { 0 };
     gfx_cc_get_features(cc, &ccf);
@@ -286,9 +290,9 @@ static struct ShaderProgram *gfx_opengl_create_and_load_new_shader(struct ColorC
 }
 
 static struct ShaderProgram *gfx_opengl_lookup_shader(struct ColorCombiner* cc) {
-    for (size_t i = 0; i < shader_program_pool_size; i++)
-        if (shader_program_pool[i].hash == cc->hash)
-            return &shader_program_pool[i];
+    for (struct ShaderProgram *prg = shader_program_hashmap[CC_HASHMAP_INDEX(cc->hash)]; prg != NULL; prg = prg->next)
+        if (prg->hash == cc->hash)
+            return prg;
     return NULL;
 }
 
@@ -37,6 +37,7 @@
 #include "pc/gfx/gfx_pc.h"
 #include "pc/gfx/gfx_rendering_api.h"
 #include "pc/gfx/gfx_screen_config.h"
+#include "pc/gfx/gfx_texture_convert.h"
 #include "pc/gfx/gfx_window_manager_api.h"
 
 // this is used for multi-textures
@@ -49,9 +50,12 @@
 u8 gGfxPcResetTex1 = 0;
 
 static struct TextureCache gfx_texture_cache = { 0 };
-static struct ColorCombiner color_combiner_pool[CC_MAX_SHADERS] = { 0 };
-static uint8_t color_combiner_pool_size = 0;
-static uint8_t color_combiner_pool_index = 0;
+
+struct ColorCombinerNode {
+    struct ColorCombiner cc;
+    struct ColorCombinerNode *next;
+};
+static struct ColorCombinerNode *color_combiner_hashmap[CC_HASHMAP_LEN] = { 0 };
 
 static struct RSP {
     ALIGNED16 Mat4 MP_matrix;
@@ -111,6 +115,8 @@ static float buf_vbo[MAX_BUFFERED * (26 * 3)] = { 0.0f }; // 3 vertices in a tri
 static size_t buf_vbo_len = 0;
 static size_t buf_vbo_num_tris = 0;
 
+static struct GfxDrawStats draw_stats = { 0 }; // reset every frame
+
 static struct GfxWindowManagerAPI *gfx_wapi = NULL;
 static struct GfxRenderingAPI *gfx_rapi = NULL;
 
@@ -161,11 +167,23 @@ void ext_gfx_run_dl(Gfx* cmd);
 static void gfx_flush(void) {
     if (buf_vbo_len > 0) {
         gfx_rapi->draw_triangles(buf_vbo, buf_vbo_len, buf_vbo_num_tris);
+        draw_stats.draw_calls++;
+        draw_stats.triangles += buf_vbo_num_tris;
         buf_vbo_len = 0;
         buf_vbo_num_tris = 0;
     }
 }
 
+// Every rendering state change ends the current batch
+static inline void gfx_flush_for_state_change(void) {
+    draw_stats.state_changes++;
+    gfx_flush();
+}
+
+void gfx_get_draw_stats(struct GfxDrawStats *stats) {
+    *stats = draw_stats;
+}
+
 static void combine_mode_update_hash(struct CombineMode* cm) {
     uint64_t hash = 5381;
 
@@ -205,6 +223,7 @@ static struct ShaderProgram *gfx_lookup_or_create_shader_program(struct ColorCom
         gfx_rapi->unload_shader(rendering_state.shader_program);
         prg = gfx_rapi->create_and_load_new_shader(cc);
         rendering_state.shader_program = prg;
+        draw_stats.shader_compiles++;
     }
     return prg;
 }
@@ -278,20 +297,26 @@ static struct ColorCombiner *gfx_lookup_or_create_color_combiner(struct CombineM
         return prev_combiner;
     }
 
-    for (size_t i = 0; i < color_combiner_pool_size; i++) {
-        if (color_combiner_pool[i].cm.hash == cm->hash) {
-            return prev_combiner = &color_combiner_pool[i];
+    // Combiners are never evicted, so the shader programs they point to stay valid
+    uint32_t index = CC_HASHMAP_INDEX(cm->hash);
+    for (struct ColorCombinerNode *node = color_combiner_hashmap[index]; node != NULL; node = node->next) {
+        if (node->cc.cm.hash == cm->hash) {
+            return prev_combiner = &node->cc;
         }
     }
 
     gfx_flush();
 
-    struct ColorCombiner *comb = &color_combiner_pool[color_combiner_pool_index];
-    color_combiner_pool_index = (color_combiner_pool_index + 1) % CC_MAX_SHADERS;
-    if (color_combiner_pool_size < CC_MAX_SHADERS) { color_combiner_pool_size++; }
+    struct ColorCombinerNode *node = calloc(1, sizeof(struct ColorCombinerNode));
+    if (node == NULL) { sys_fatal("out of memory allocating color combiner"); }
+    node->next = color_combiner_hashmap[index];
+    color_combiner_hashmap[index] = node;
+    draw_stats.combiner_misses++;
 
+    struct ColorCombiner *comb = &node->cc;
     memcpy(&comb->cm, cm, sizeof(struct CombineMode));
     gfx_generate_cc(comb);
+    gfx_cc_cache_record(&comb->cm);
 
     return prev_combiner = comb;
 }
@@ -300,44 +325,71 @@ void gfx_texture_cache_clear(void) {
     memset(&gfx_texture_cache, 0, sizeof(gfx_texture_cache));
 }
 
-static bool gfx_texture_cache_lookup(int tile, struct TextureHashmapNode **n, const uint8_t *orig_addr, uint32_t fmt, uint32_t siz) {
-    size_t hash = (uintptr_t)orig_addr;
-#define CMPADDR(x, y) x == y
+static inline uint32_t gfx_texture_cache_hash(const void *addr) {
+    // texture addresses are aligned, so mix the bits instead of masking the raw address
+    uint64_t hash = (uint64_t)(uintptr_t)addr * 0x9E3779B97F4A7C15ULL;
+    return (uint32_t)(hash >> 40) & HASH_MASK;
+}
+
+static struct TextureHashmapNode *gfx_texture_cache_alloc(void) {
+    if (gfx_texture_cache.pool_pos < MAX_CACHED_TEXTURES) {
+        struct TextureHashmapNode *node = &gfx_texture_cache.pool[gfx_texture_cache.pool_pos++];
+        node->texture_id = gfx_rapi->new_texture();
+        return node;
+    }
+
+    // Pool is full, evict the first texture that wasn't used since the clock hand last passed it
+    struct TextureHashmapNode *node = NULL;
+    while (true) {
+        node = &gfx_texture_cache.pool[gfx_texture_cache.clock_hand];
+        gfx_texture_cache.clock_hand = (gfx_texture_cache.clock_hand + 1) % MAX_CACHED_TEXTURES;
+        if (node == rendering_state.textures[0] || node == rendering_state.textures[1]) { continue; }
+        if (!node->referenced) { break; }
+        node->referenced = false;
+    }
+
+    // Unlink it from its bucket, the texture id is reused for the new texture
+    struct TextureHashmapNode **link = &gfx_texture_cache.hashmap[gfx_texture_cache_hash(node->texture_addr)];
+    while (*link != NULL && *link != node) {
+        link = &(*link)->next;
+    }
+    if (*link == node) { *link = node->next; }
+    gfx_texture_cache.stats.evictions++;
+    return node;
+}
 
-    hash = (hash >> HASH_SHIFT) & HASH_MASK;
+bool gfx_texture_cache_lookup(int tile, struct TextureHashmapNode **n, const void *orig_addr, uint32_t fmt, uint32_t siz) {
+    uint32_t hash = gfx_texture_cache_hash(orig_addr);
 
-    struct TextureHashmapNode **node = &gfx_texture_cache.hashmap[hash];
-    while (node != NULL && *node != NULL && *node - gfx_texture_cache.pool < (int)gfx_texture_cache.pool_pos) {
-        if (CMPADDR((*node)->texture_addr, orig_addr) && (*node)->fmt == fmt && (*node)->siz == siz) {
-            gfx_rapi->select_texture(tile, (*node)->texture_id);
-            *n = *node;
+    for (struct TextureHashmapNode *node = gfx_texture_cache.hashmap[hash]; node != NULL; node = node->next) {
+        if (node->texture_addr == orig_addr && node->fmt == fmt && node->siz == siz) {
+            gfx_rapi->select_texture(tile, node->texture_id);
+            node->referenced = true;
+            gfx_texture_cache.stats.hits++;
+            *n = node;
             return true;
         }
-        node = &(*node)->next;
-    }
-    if (gfx_texture_cache.pool_pos >= sizeof(gfx_texture_cache.pool) / sizeof(struct TextureHashmapNode)) {
-        // Pool is full. We just invalidate everything and start over.
-        gfx_texture_cache.pool_pos = 0;
-        node = &gfx_texture_cache.hashmap[hash];
-        // puts("Clearing texture cache");
-    }
-    if (!node) { return false; }
-    *node = &gfx_texture_cache.pool[gfx_texture_cache.pool_pos++];
-    if ((*node)->texture_addr == NULL) {
-        (*node)->texture_id = gfx_rapi->new_texture();
     }
-    gfx_rapi->select_texture(tile, (*node)->texture_id);
+    gfx_texture_cache.stats.misses++;
+
+    struct TextureHashmapNode *node = gfx_texture_cache_alloc();
+    gfx_rapi->select_texture(tile, node->texture_id);
     gfx_rapi->set_sampler_parameters(tile, false, 0, 0);
-    (*node)->next = NULL;
-    (*node)->texture_addr = orig_addr;
-    (*node)->fmt = fmt;
-    (*node)->siz = siz;
-    (*node)->cms = 0;
-    (*node)->cmt = 0;
-    (*node)->linear_filter = false;
-    *n = *node;
+    node->next = gfx_texture_cache.hashmap[hash];
+    node->texture_addr = orig_addr;
+    node->fmt = fmt;
+    node->siz = siz;
+    node->cms = 0;
+    node->cmt = 0;
+    node->linear_filter = false;
+    node->referenced = true;
+    gfx_texture_cache.hashmap[hash] = node;
+    *n = node;
     return false;
-    #undef CMPADDR
+}
+
+void gfx_texture_cache_get_stats(struct TextureCacheStats *stats) {
+    *stats = gfx_texture_cache.stats;
 }
 
 static void import_texture_rgba32(int tile) {
@@ -354,17 +406,7 @@ static void import_texture_rgba16(int tile) {
     if (rdp.loaded_texture[tile].size_bytes * 2 > 8192) { return; }
     uint8_t rgba32_buf[8192];
 
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes / 2; i++) {
-        uint16_t col16 = (rdp.loaded_texture[tile].addr[2 * i] << 8) | rdp.loaded_texture[tile].addr[2 * i + 1];
-        uint8_t a = col16 & 1;
-        uint8_t r = col16 >> 11;
-        uint8_t g = (col16 >> 6) & 0x1f;
-        uint8_t b = (col16 >> 1) & 0x1f;
-        rgba32_buf[4*i + 0] = SCALE_5_8(r);
-        rgba32_buf[4*i + 1] = SCALE_5_8(g);
-        rgba32_buf[4*i + 2] = SCALE_5_8(b);
-        rgba32_buf[4*i + 3] = a ? 255 : 0;
-    }
+    gfx_convert_rgba16_rgba32(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes / 2);
 
     uint32_t width = rdp.texture_tile.line_size_bytes / 2;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -378,19 +420,7 @@ static void import_texture_ia4(int tile) {
     if (rdp.loaded_texture[tile].size_bytes * 8 > 32768) { return; }
     uint8_t rgba32_buf[32768];
 
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes * 2; i++) {
-        uint8_t byte = rdp.loaded_texture[tile].addr[i / 2];
-        uint8_t part = (byte >> (4 - (i % 2) * 4)) & 0xf;
-        uint8_t intensity = part >> 1;
-        uint8_t alpha = part & 1;
-        uint8_t r = intensity;
-        uint8_t g = intensity;
-        uint8_t b = intensity;
-        rgba32_buf[4*i + 0] = SCALE_3_8(r);
-        rgba32_buf[4*i + 1] = SCALE_3_8(g);
-        rgba32_buf[4*i + 2] = SCALE_3_8(b);
-        rgba32_buf[4*i + 3] = alpha ? 255 : 0;
-    }
+    gfx_convert_ia4_rgba32(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes * 2);
 
     uint32_t width = rdp.texture_tile.line_size_bytes * 2;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -404,17 +434,7 @@ static void import_texture_ia8(int tile) {
     if (rdp.loaded_texture[tile].size_bytes * 4 > 16384) { return; }
     uint8_t rgba32_buf[16384];
 
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes; i++) {
-        uint8_t intensity = rdp.loaded_texture[tile].addr[i] >> 4;
-        uint8_t alpha = rdp.loaded_texture[tile].addr[i] & 0xf;
-        uint8_t r = intensity;
-        uint8_t g = intensity;
-        uint8_t b = intensity;
-        rgba32_buf[4*i + 0] = SCALE_4_8(r);
-        rgba32_buf[4*i + 1] = SCALE_4_8(g);
-        rgba32_buf[4*i + 2] = SCALE_4_8(b);
-        rgba32_buf[4*i + 3] = SCALE_4_8(alpha);
-    }
+    gfx_convert_ia8_rgba32(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes);
 
     uint32_t width = rdp.texture_tile.line_size_bytes;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -428,17 +448,7 @@ static void import_texture_ia16(int tile) {
     if (rdp.loaded_texture[tile].size_bytes * 2 > 8192) { return; }
     uint8_t rgba32_buf[8192];
 
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes / 2; i++) {
-        uint8_t intensity = rdp.loaded_texture[tile].addr[2 * i];
-        uint8_t alpha = rdp.loaded_texture[tile].addr[2 * i + 1];
-        uint8_t r = intensity;
-        uint8_t g = intensity;
-        uint8_t b = intensity;
-        rgba32_buf[4*i + 0] = r;
-        rgba32_buf[4*i + 1] = g;
-        rgba32_buf[4*i + 2] = b;
-        rgba32_buf[4*i + 3] = alpha;
-    }
+    gfx_convert_ia16_rgba32(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes / 2);
 
     uint32_t width = rdp.texture_tile.line_size_bytes / 2;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -452,14 +462,7 @@ static void import_texture_i4(int tile) {
     if (rdp.loaded_texture[tile].size_bytes * 8 > 32768) { return; }
     uint8_t rgba32_buf[32768];
 
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes * 2; i++) {
-        uint8_t byte = rdp.loaded_texture[tile].addr[i / 2];
-        uint8_t intensity = (byte >> (4 - (i % 2) * 4)) & 0xf;
-        rgba32_buf[4*i + 0] = SCALE_4_8(intensity);
-        rgba32_buf[4*i + 1] = SCALE_4_8(intensity);
-        rgba32_buf[4*i + 2] = SCALE_4_8(intensity);
-        rgba32_buf[4*i + 3] = 255;
-    }
+    gfx_convert_i4_rgba32(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes * 2);
 
     uint32_t width = rdp.texture_tile.line_size_bytes * 2;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -473,13 +476,7 @@ static void import_texture_i8(int tile) {
     if (rdp.loaded_texture[tile].size_bytes * 4 > 16384) { return; }
     uint8_t rgba32_buf[16384];
 
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes; i++) {
-        uint8_t intensity = rdp.loaded_texture[tile].addr[i];
-        rgba32_buf[4*i + 0] = intensity;
-        rgba32_buf[4*i + 1] = intensity;
-        rgba32_buf[4*i + 2] = intensity;
-        rgba32_buf[4*i + 3] = 255;
-    }
+    gfx_convert_i8_rgba32(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes);
 
     uint32_t width = rdp.texture_tile.line_size_bytes;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -493,19 +490,7 @@ static void import_texture_ci4(int tile) {
     if (rdp.loaded_texture[tile].size_bytes * 8 > 32768) { return; }
     uint8_t rgba32_buf[32768];
 
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes * 2; i++) {
-        uint8_t byte = rdp.loaded_texture[tile].addr[i / 2];
-        uint8_t idx = (byte >> (4 - (i % 2) * 4)) & 0xf;
-        uint16_t col16 = (rdp.palette[idx * 2] << 8) | rdp.palette[idx * 2 + 1]; // Big endian load
-        uint8_t a = col16 & 1;
-        uint8_t r = col16 >> 11;
-        uint8_t g = (col16 >> 6) & 0x1f;
-        uint8_t b = (col16 >> 1) & 0x1f;
-        rgba32_buf[4*i + 0] = SCALE_5_8(r);
-        rgba32_buf[4*i + 1] = SCALE_5_8(g);
-        rgba32_buf[4*i + 2] = SCALE_5_8(b);
-        rgba32_buf[4*i + 3] = a ? 255 : 0;
-    }
+    gfx_convert_ci4_rgba32(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes * 2, rdp.palette);
 
     uint32_t width = rdp.texture_tile.line_size_bytes * 2;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -519,18 +504,7 @@ static void import_texture_ci8(int tile) {
     if (rdp.loaded_texture[tile].size_bytes * 4 > 16384) { return; }
     uint8_t rgba32_buf[16384];
 
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes; i++) {
-        uint8_t idx = rdp.loaded_texture[tile].addr[i];
-        uint16_t col16 = (rdp.palette[idx * 2] << 8) | rdp.palette[idx * 2 + 1]; // Big endian load
-        uint8_t a = col16 & 1;
-        uint8_t r = col16 >> 11;
-        uint8_t g = (col16 >> 6) & 0x1f;
-        uint8_t b = (col16 >> 1) & 0x1f;
-        rgba32_buf[4*i + 0] = SCALE_5_8(r);
-        rgba32_buf[4*i + 1] = SCALE_5_8(g);
-        rgba32_buf[4*i + 2] = SCALE_5_8(b);
-        rgba32_buf[4*i + 3] = a ? 255 : 0;
-    }
+    gfx_convert_ci8_rgba32(rgba32_buf, rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes, rdp.palette);
 
     uint32_t width = rdp.texture_tile.line_size_bytes;
     uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
@@ -540,8 +514,8 @@ static void import_texture_ci8(int tile) {
 
 static void import_texture(int tile) {
     tile = tile % RDP_TILES;
-    extern s32 dynos_tex_import(void **output, void *ptr, s32 tile, void *grapi, void **hashmap, void *pool, s32 *poolpos, s32 poolsize);
-    if (dynos_tex_import((void **) &rendering_state.textures[tile], (void *) rdp.loaded_texture[tile].addr, tile, gfx_rapi, (void **) gfx_texture_cache.hashmap, (void *) gfx_texture_cache.pool, (int *) &gfx_texture_cache.pool_pos, MAX_CACHED_TEXTURES)) { return; }
+    extern s32 dynos_tex_import(void **output, void *ptr, s32 tile, void *grapi);
+    if (dynos_tex_import((void **) &rendering_state.textures[tile], (void *) rdp.loaded_texture[tile].addr, tile, gfx_rapi)) { return; }
     uint8_t fmt = rdp.texture_tile.fmt;
     uint8_t siz = rdp.texture_tile.siz;
 
@@ -603,6 +577,18 @@ static void import_texture(int tile) {
     //printf("Time diff: %d\n", t1 - t0);
 }
 
+// Display lists often reload the texture that is already bound, which doesn't need to end the batch.
+// Only plain cache entries are matched here, DynOS textures always go through import_texture
+static bool gfx_texture_is_bound(int tile) {
+    tile = tile % RDP_TILES;
+    struct TextureHashmapNode *node = rendering_state.textures[tile];
+    return node != NULL
+        && rdp.loaded_texture[tile].addr != NULL
+        && node->texture_addr == rdp.loaded_texture[tile].addr
+        && node->fmt == rdp.texture_tile.fmt
+        && node->siz == rdp.texture_tile.siz;
+}
+
 static void OPTIMIZE_O3 gfx_transposed_matrix_mul(Vec3f res, const Vec3f a, const Mat4 b) {
     res[0] = a[0] * b[0][0] + a[1] * b[0][1] + a[2] * b[0][2];
     res[1] = a[0] * b[1][0] + a[1] * b[1][1] + a[2] * b[1][2];
@@ -940,21 +926,21 @@ static void OPTIMIZE_O3 gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t
 
     bool depth_test = (rsp.geometry_mode & G_ZBUFFER) == G_ZBUFFER;
     if (depth_test != rendering_state.depth_test) {
-        gfx_flush();
+        gfx_flush_for_state_change();
         gfx_rapi->set_depth_test(depth_test);
         rendering_state.depth_test = depth_test;
     }
 
     bool z_upd = (rdp.other_mode_l & Z_UPD) == Z_UPD;
     if (z_upd != rendering_state.depth_mask) {
-        gfx_flush();
+        gfx_flush_for_state_change();
         gfx_rapi->set_depth_mask(z_upd);
         rendering_state.depth_mask = z_upd;
     }
 
     bool zmode_decal = (rdp.other_mode_l & ZMODE_DEC) == ZMODE_DEC;
     if (zmode_decal != rendering_state.decal_mode) {
-        gfx_flush();
+        gfx_flush_for_state_change();
         gfx_rapi->set_zmode_decal(zmode_decal);
         rendering_state.decal_mode = zmode_decal;
     }
@@ -963,13 +949,13 @@ static void OPTIMIZE_O3 gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t
         static uint32_t x_adjust_4by3_prev;
         if (memcmp(&rdp.viewport, &rendering_state.viewport, sizeof(rdp.viewport)) != 0
             || x_adjust_4by3_prev != gfx_current_dimensions.x_adjust_4by3) {
-            gfx_flush();
+            gfx_flush_for_state_change();
             gfx_rapi->set_viewport(rdp.viewport.x + gfx_current_dimensions.x_adjust_4by3, rdp.viewport.y, rdp.viewport.width, rdp.viewport.height);
             rendering_state.viewport = rdp.viewport;
         }
         if (memcmp(&rdp.scissor, &rendering_state.scissor, sizeof(rdp.scissor)) != 0
             || x_adjust_4by3_prev != gfx_current_dimensions.x_adjust_4by3) {
-            gfx_flush();
+            gfx_flush_for_state_change();
             gfx_rapi->set_scissor(rdp.scissor.x + gfx_current_dimensions.x_adjust_4by3, rdp.scissor.y, rdp.scissor.width, rdp.scissor.height);
             rendering_state.scissor = rdp.scissor;
         }
@@ -1002,13 +988,13 @@ static void OPTIMIZE_O3 gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t
 
     struct ShaderProgram *prg = comb->prg;
     if (prg != rendering_state.shader_program) {
-        gfx_flush();
+        gfx_flush_for_state_change();
         gfx_rapi->unload_shader(rendering_state.shader_program);
         gfx_rapi->load_shader(prg);
         rendering_state.shader_program = prg;
     }
     if (cm->use_alpha != rendering_state.alpha_blend) {
-        gfx_flush();
+        gfx_flush_for_state_change();
         gfx_rapi->set_use_alpha(cm->use_alpha);
         rendering_state.alpha_blend = cm->use_alpha;
     }
@@ -1019,15 +1005,19 @@ static void OPTIMIZE_O3 gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t
     for (int32_t i = 0; i < 2; i++) {
         if (used_textures[i]) {
             if (rdp.textures_changed[i]) {
-                gfx_flush();
-                import_texture(i);
+                if (gfx_texture_is_bound(i)) {
+                    draw_stats.texture_rebinds_skipped++;
+                } else {
+                    gfx_flush_for_state_change();
+                    import_texture(i);
+                }
                 rdp.textures_changed[i] = false;
             }
             bool linear_filter = configFiltering && ((rdp.other_mode_h & (3U << G_MDSFT_TEXTFILT)) != G_TF_POINT);
             struct TextureHashmapNode* tex = rendering_state.textures[i];
             if (tex) {
                 if (linear_filter != tex->linear_filter || rdp.texture_tile.cms != tex->cms || rdp.texture_tile.cmt != rendering_state.textures[i]->cmt) {
-                    gfx_flush();
+                    gfx_flush_for_state_change();
                     gfx_rapi->set_sampler_parameters(i, linear_filter, rdp.texture_tile.cms, rdp.texture_tile.cmt);
                     tex->linear_filter = linear_filter;
                     tex->cms = rdp.texture_tile.cms;
@@ -1880,6 +1870,14 @@ void gfx_start_frame(void) {
 
 void gfx_run(Gfx *commands) {
     gfx_sp_reset();
+    memset(&gfx_texture_cache.stats, 0, sizeof(gfx_texture_cache.stats));
+    memset(&draw_stats, 0, sizeof(draw_stats));
+
+    // Forget the bound textures once per frame, so texture overrides are looked up again
+    rendering_state.textures[0] = NULL;
+    rendering_state.textures[1] = NULL;
+    rdp.textures_changed[0] = true;
+    rdp.textures_changed[1] = true;
 
     //puts("New frame");
 
@@ -23,6 +23,9 @@ void gfx_start_frame(void);
 void gfx_run(Gfx *commands);
 void gfx_end_frame(void);
 void gfx_shutdown(void);
+bool gfx_texture_cache_lookup(int tile, struct TextureHashmapNode **n, const void *orig_addr, uint32_t fmt, uint32_t siz);
+void gfx_texture_cache_get_stats(struct TextureCacheStats *stats);
+void gfx_get_draw_stats(struct GfxDrawStats *stats);
 void gfx_pc_precomp_shader(uint32_t rgb1, uint32_t alpha1, uint32_t rgb2, uint32_t alpha2, uint32_t flags);
 
 #ifdef __cplusplus
@@ -0,0 +1,194 @@
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "pc/gfx/gfx.h"
+#include "pc/gfx/gfx_texture_convert.h"
+
+// Every kernel has a vectorized path when available and a scalar path for the remaining pixels,
+// both produce exactly the same output as the SCALE_M_N macros.
+// 4-bit and paletted formats go through a small pixel table instead.
+
+static inline uint32_t gfx_convert_pack(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    uint8_t px[4] = { r, g, b, a };
+    uint32_t packed;
+    memcpy(&packed, px, sizeof(packed));
+    return packed;
+}
+
+static inline uint32_t gfx_convert_rgba16_pixel(const uint8_t *col) {
+    uint16_t col16 = (col[0] << 8) | col[1]; // Big endian load
+    return gfx_convert_pack(
+        SCALE_5_8((col16 >> 11) & 0x1F),
+        SCALE_5_8((col16 >>  6) & 0x1F),
+        SCALE_5_8((col16 >>  1) & 0x1F),
+        (col16 & 1) ? 255 : 0
+    );
+}
+
+static inline void gfx_convert_4b_with_table(uint8_t *dst, const uint8_t *src, uint32_t pixels, const uint32_t table[16]) {
+    uint32_t i = 0;
+    for (; i + 1 < pixels; i += 2) {
+        uint8_t byte = src[i / 2];
+        memcpy(dst + 4 * i + 0, &table[byte >> 4], 4);
+        memcpy(dst + 4 * i + 4, &table[byte & 0xF], 4);
+    }
+    if (i < pixels) {
+        memcpy(dst + 4 * i, &table[src[i / 2] >> 4], 4);
+    }
+}
+
+#ifdef __SSE2__
+// SCALE_5_8 on 16-bit lanes: (x * 255) / 31 == ((x * 255) * 8457) >> 18 for every 5-bit x
+static inline __m128i gfx_convert_scale_5_8_epi16(__m128i x) {
+    __m128i n = _mm_mullo_epi16(x, _mm_set1_epi16(0xFF));
+    return _mm_srli_epi16(_mm_mulhi_epu16(n, _mm_set1_epi16(8457)), 2);
+}
+
+// Interleave 16-bit lanes holding r, g, b, a (0-255) into 8 RGBA32 pixels
+static inline void gfx_convert_store_rgba_epi16(uint8_t *dst, __m128i r, __m128i g, __m128i b, __m128i a) {
+    __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+    __m128i ba = _mm_or_si128(b, _mm_slli_epi16(a, 8));
+    _mm_storeu_si128((__m128i *)(dst + 0),  _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi16(rg, ba));
+}
+
+// Write 16 pixels from 16 intensity bytes and 16 alpha bytes
+static inline void gfx_convert_store_ia_epi8(uint8_t *dst, __m128i i, __m128i a) {
+    __m128i iiLo = _mm_unpacklo_epi8(i, i);
+    __m128i iiHi = _mm_unpackhi_epi8(i, i);
+    __m128i iaLo = _mm_unpacklo_epi8(i, a);
+    __m128i iaHi = _mm_unpackhi_epi8(i, a);
+    _mm_storeu_si128((__m128i *)(dst + 0),  _mm_unpacklo_epi16(iiLo, iaLo));
+    _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi16(iiLo, iaLo));
+    _mm_storeu_si128((__m128i *)(dst + 32), _mm_unpacklo_epi16(iiHi, iaHi));
+    _mm_storeu_si128((__m128i *)(dst + 48), _mm_unpackhi_epi16(iiHi, iaHi));
+}
+#endif
+
+void gfx_convert_rgba16_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels) {
+    uint32_t i = 0;
+#ifdef __SSE2__
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i mask1 = _mm_set1_epi16(0x01);
+    const __m128i mask8 = _mm_set1_epi16(0xFF);
+    for (; i + 8 <= pixels; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + 2 * i));
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)); // Big endian load
+        __m128i r = gfx_convert_scale_5_8_epi16(_mm_and_si128(_mm_srli_epi16(v, 11), mask5));
+        __m128i g = gfx_convert_scale_5_8_epi16(_mm_and_si128(_mm_srli_epi16(v,  6), mask5));
+        __m128i b = gfx_convert_scale_5_8_epi16(_mm_and_si128(_mm_srli_epi16(v,  1), mask5));
+        __m128i a = _mm_and_si128(_mm_sub_epi16(_mm_setzero_si128(), _mm_and_si128(v, mask1)), mask8);
+        gfx_convert_store_rgba_epi16(dst + 4 * i, r, g, b, a);
+    }
+#endif
+    for (; i < pixels; i++) {
+        uint32_t px = gfx_convert_rgba16_pixel(src + 2 * i);
+        memcpy(dst + 4 * i, &px, 4);
+    }
+}
+
+void gfx_convert_ia4_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels) {
+    uint32_t table[16];
+    for (uint32_t n = 0; n < 16; n++) {
+        uint8_t intensity = SCALE_3_8(n >> 1);
+        table[n] = gfx_convert_pack(intensity, intensity, intensity, (n & 1) ? 255 : 0);
+    }
+    gfx_convert_4b_with_table(dst, src, pixels, table);
+}
+
+void gfx_convert_ia8_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels) {
+    uint32_t i = 0;
+#ifdef __SSE2__
+    const __m128i maskHi = _mm_set1_epi8((char) 0xF0);
+    const __m128i maskLo = _mm_set1_epi8(0x0F);
+    for (; i + 16 <= pixels; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_and_si128(v, maskHi);
+        __m128i lo = _mm_and_si128(v, maskLo);
+        __m128i intensity = _mm_or_si128(hi, _mm_srli_epi16(hi, 4));
+        __m128i alpha = _mm_or_si128(lo, _mm_slli_epi16(lo, 4));
+        gfx_convert_store_ia_epi8(dst + 4 * i, intensity, alpha);
+    }
+#endif
+    for (; i < pixels; i++) {
+        uint8_t intensity = SCALE_4_8(src[i] >> 4);
+        uint8_t alpha = SCALE_4_8(src[i] & 0xF);
+        uint32_t px = gfx_convert_pack(intensity, intensity, intensity, alpha);
+        memcpy(dst + 4 * i, &px, 4);
+    }
+}
+
+void gfx_convert_ia16_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels) {
+    uint32_t i = 0;
+#ifdef __SSE2__
+    const __m128i mask8 = _mm_set1_epi16(0xFF);
+    for (; i + 8 <= pixels; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + 2 * i));
+        __m128i intensity = _mm_and_si128(v, mask8);
+        __m128i ii = _mm_or_si128(intensity, _mm_slli_epi16(intensity, 8));
+        _mm_storeu_si128((__m128i *)(dst + 4 * i + 0),  _mm_unpacklo_epi16(ii, v));
+        _mm_storeu_si128((__m128i *)(dst + 4 * i + 16), _mm_unpackhi_epi16(ii, v));
+    }
+#endif
+    for (; i < pixels; i++) {
+        uint8_t intensity = src[2 * i];
+        uint32_t px = gfx_convert_pack(intensity, intensity, intensity, src[2 * i + 1]);
+        memcpy(dst + 4 * i, &px, 4);
+    }
+}
+
+void gfx_convert_i4_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels) {
+    uint32_t table[16];
+    for (uint32_t n = 0; n < 16; n++) {
+        table[n] = gfx_convert_pack(SCALE_4_8(n), SCALE_4_8(n), SCALE_4_8(n), 255);
+    }
+    gfx_convert_4b_with_table(dst, src, pixels, table);
+}
+
+void gfx_convert_i8_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels) {
+    uint32_t i = 0;
+#ifdef __SSE2__
+    const __m128i opaque = _mm_set1_epi8((char) 0xFF);
+    for (; i + 16 <= pixels; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        gfx_convert_store_ia_epi8(dst + 4 * i, v, opaque);
+    }
+#endif
+    for (; i < pixels; i++) {
+        uint32_t px = gfx_convert_pack(src[i], src[i], src[i], 255);
+        memcpy(dst + 4 * i, &px, 4);
+    }
+}
+
+// Palette entries are converted on first use only, palettes can be shorter than the format allows
+static inline uint32_t gfx_convert_palette_lookup(uint32_t *table, uint8_t *converted, const uint8_t *palette, uint8_t idx) {
+    if (!converted[idx]) {
+        table[idx] = gfx_convert_rgba16_pixel(palette + idx * 2);
+        converted[idx] = true;
+    }
+    return table[idx];
+}
+
+void gfx_convert_ci4_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels, const uint8_t *palette) {
+    uint32_t table[16];
+    uint8_t converted[16] = { 0 };
+    for (uint32_t i = 0; i < pixels; i++) {
+        uint8_t idx = (src[i / 2] >> (4 - (i % 2) * 4)) & 0xF;
+        uint32_t px = gfx_convert_palette_lookup(table, converted, palette, idx);
+        memcpy(dst + 4 * i, &px, 4);
+    }
+}
+
+void gfx_convert_ci8_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels, const uint8_t *palette) {
+    uint32_t table[256];
+    uint8_t converted[256] = { 0 };
+    for (uint32_t i = 0; i < pixels; i++) {
+        uint32_t px = gfx_convert_palette_lookup(table, converted, palette, src[i]);
+        memcpy(dst + 4 * i, &px, 4);
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef GFX_TEXTURE_CONVERT_H
+#define GFX_TEXTURE_CONVERT_H
+
+#include <stdint.h>
+
+// N64 texture formats to RGBA32 conversion, shared by gfx_pc and DynOS
+// dst must hold 4 bytes per pixel, 4-bit formats contain two pixels per source byte (high nibble first)
+// palettes are big-endian RGBA16 entries, as loaded by the RDP
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void gfx_convert_rgba16_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels);
+void gfx_convert_ia4_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels);
+void gfx_convert_ia8_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels);
+void gfx_convert_ia16_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels);
+void gfx_convert_i4_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels);
+void gfx_convert_i8_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels);
+void gfx_convert_ci4_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels, const uint8_t *palette);
+void gfx_convert_ci8_rgba32(uint8_t *dst, const uint8_t *src, uint32_t pixels, const uint8_t *palette);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1666,6 +1666,7 @@ static struct LuaObjectField sObjectFields[LUA_OBJECT_FIELD_COUNT] = {
     { "allowRemoteInteractions",                    LVT_U8,                  offsetof(struct Object, allowRemoteInteractions),                    false, LOT_NONE,         1, sizeof(u8)                    },
     { "areaTimer",                                  LVT_U32,                 offsetof(struct Object, areaTimer),                                  false, LOT_NONE,         1, sizeof(u32)                   },
     { "areaTimerDuration",                          LVT_U32,                 offsetof(struct Object, areaTimerDuration),                          false, LOT_NONE,         1, sizeof(u32)                   },
+//  { "areaTimerFastForwardCallback)(u32 ticks)",    LVT_???,                 offsetof(struct Object, areaTimerFastForwardCallback)(u32 ticks)),    false, LOT_???,          1, sizeof(void (*)               }, <--- UNIMPLEMENTED
 //  { "areaTimerRunOnceCallback)(void)",            LVT_???,                 offsetof(struct Object, areaTimerRunOnceCallback)(void)),            false, LOT_???,          1, sizeof(void (*)               }, <--- UNIMPLEMENTED
     { "areaTimerType",                              LVT_S32,                 offsetof(struct Object, areaTimerType),                              false, LOT_NONE,         1, sizeof(enum AreaTimerType)    },
     { "behavior",                                   LVT_BEHAVIORSCRIPT_P,    offsetof(struct Object, behavior),                                   true,  LOT_POINTER,      1, sizeof(const BehaviorScript*) },
@@ -1452,6 +1452,42 @@ struct LuaHookedBehavior {
 static struct LuaHookedBehavior sHookedBehaviors[MAX_HOOKED_BEHAVIORS] = { 0 };
 static int sHookedBehaviorsCount = 0;
 
+// Bumped whenever the hooked behaviors change, forgetting every object's hook
+static u32 sHookedBehaviorsGeneration = 1;
+
+// The hooked behavior every object was last found to run, by object pool index.
+// Objects keep their behavior for their lifetime, so they're only searched for again
+// when the pool slot is reused for another behavior or the hooks change.
+struct ObjectBehaviorHook {
+    const BehaviorScript *behavior;
+    u32 generation;
+    s16 hookIndex;
+};
+static struct ObjectBehaviorHook sObjectBehaviorHooks[OBJECT_POOL_CAPACITY] = { 0 };
+
+static s16 smlua_find_behavior_hook(const BehaviorScript *behavior) {
+    for (int i = 0; i < sHookedBehaviorsCount; i++) {
+        if (sHookedBehaviors[i].behavior == behavior) { return i; }
+    }
+    return -1;
+}
+
+static struct LuaHookedBehavior *smlua_get_object_behavior_hook(struct Object *object) {
+    s32 poolIndex = object - gObjectPool;
+    if (poolIndex < 0 || poolIndex >= OBJECT_POOL_CAPACITY) {
+        s16 hookIndex = smlua_find_behavior_hook(object->behavior);
+        return (hookIndex < 0) ? NULL : &sHookedBehaviors[hookIndex];
+    }
+
+    struct ObjectBehaviorHook *hook = &sObjectBehaviorHooks[poolIndex];
+    if (hook->behavior != object->behavior || hook->generation != sHookedBehaviorsGeneration) {
+        hook->behavior = object->behavior;
+        hook->generation = sHookedBehaviorsGeneration;
+        hook->hookIndex = smlua_find_behavior_hook(object->behavior);
+    }
+    return (hook->hookIndex < 0) ? NULL : &sHookedBehaviors[hook->hookIndex];
+}
+
 enum BehaviorId smlua_get_original_behavior_id(const BehaviorScript* behavior) {
     enum BehaviorId id = get_id_from_behavior(behavior);
     for (int i = 0; i < sHookedBehaviorsCount; i++) {
@@ -1534,6 +1570,7 @@ int smlua_hook_custom_bhv(BehaviorScript *bhvScript, const char *bhvName) {
     hooked->mod = gLuaActiveMod;
 
     sHookedBehaviorsCount++;
+    sHookedBehaviorsGeneration++;
 
     // We want to push the behavior into the global LUA state. So mods can access it.
     // It's also used for some things that would normally access a LUA behavior instead.
@@ -1675,6 +1712,7 @@ int smlua_hook_behavior(lua_State* L) {
     hooked->mod = gLuaActiveMod;
 
     sHookedBehaviorsCount++;
+    sHookedBehaviorsGeneration++;
 
     // We want to push the behavior into the global LUA state. So mods can access it.
     // It's also used for some things that would normally access a LUA behavior instead.
@@ -1691,54 +1729,50 @@ int smlua_hook_behavior(lua_State* L) {
 bool smlua_call_behavior_hook(const BehaviorScript** behavior, struct Object* object, bool before) {
     lua_State* L = gLuaState;
     if (L == NULL) { return false; }
-    for (int i = 0; i < sHookedBehaviorsCount; i++) {
-        struct LuaHookedBehavior* hooked = &sHookedBehaviors[i];
-
-        // find behavior
-        if (object->behavior != hooked->behavior) {
-            continue;
-        }
 
-        // Figure out whether to run before or after
-        if (before && !hooked->replace) {
-            return false;
-        }
-        if (!before && hooked->replace) {
-            return false;
-        }
+    // find behavior
+    struct LuaHookedBehavior* hooked = smlua_get_object_behavior_hook(object);
+    if (hooked == NULL) {
+        return false;
+    }
 
-        // This behavior doesn't call it's LUA functions in this manner. It actually uses the normal behavior
-        // system.
-        if (!hooked->luaBehavior) {
-            return false;
-        }
+    // Figure out whether to run before or after
+    if (before && !hooked->replace) {
+        return false;
+    }
+    if (!before && hooked->replace) {
+        return false;
+    }
 
-        // retrieve and remember first run
-        bool firstRun = (object->curBhvCommand == hooked->originalBehavior) || (object->curBhvCommand == hooked->behavior);
-        if (firstRun && hooked->replace) { *behavior = &hooked->behavior[1]; }
+    // This behavior doesn't call it's LUA functions in this manner. It actually uses the normal behavior
+    // system.
+    if (!hooked->luaBehavior) {
+        return false;
+    }
 
-        // get function and null check it
-        int reference = firstRun ? hooked->initReference : hooked->loopReference;
-        if (reference == 0) {
-            return true;
-        }
+    // retrieve and remember first run
+    bool firstRun = (object->curBhvCommand == hooked->originalBehavior) || (object->curBhvCommand == hooked->behavior);
+    if (firstRun && hooked->replace) { *behavior = &hooked->behavior[1]; }
 
-        // push the callback onto the stack
-        lua_rawgeti(L, LUA_REGISTRYINDEX, reference);
+    // get function and null check it
+    int reference = firstRun ? hooked->initReference : hooked->loopReference;
+    if (reference == 0) {
+        return true;
+    }
 
-        // push object
-        smlua_push_object(L, LOT_OBJECT, object, NULL);
+    // push the callback onto the stack
+    lua_rawgeti(L, LUA_REGISTRYINDEX, reference);
 
-        // call the callback
-        if (0 != smlua_call_hook(L, 1, 0, 0, hooked->mod)) {
-            LOG_LUA("Failed to call the behavior callback: %u", hooked->behaviorId);
-            return true;
-        }
+    // push object
+    smlua_push_object(L, LOT_OBJECT, object, NULL);
 
-        return hooked->replace;
+    // call the callback
+    if (0 != smlua_call_hook(L, 1, 0, 0, hooked->mod)) {
+        LOG_LUA("Failed to call the behavior callback: %u", hooked->behaviorId);
+        return true;
     }
 
-    return false;
+    return hooked->replace;
 }
 
 
@@ -2565,6 +2599,7 @@ void smlua_clear_hooks(void) {
         hooked->mod = NULL;
     }
     sHookedBehaviorsCount = 0;
+    sHookedBehaviorsGeneration++;
     memset(gLuaMarioActionIndex, 0, sizeof(gLuaMarioActionIndex));
 }
 
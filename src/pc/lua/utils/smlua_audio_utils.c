@@ -263,6 +263,24 @@ struct ModAudio* audio_load_internal(const char* filename, bool isStream) {
     // remember file
     audio->file = modFile;
 
+    // streams are decoded straight from the file by the miniaudio thread, a chunk at a time,
+    // so only samples and files that only exist in memory (downloaded mods) are read whole
+    if (isStream && !f_in_memory(modFile->cachedPath)) {
+        ma_result result = ma_decoder_init_file(modFile->cachedPath, NULL, &audio->decoder);
+        if (result == MA_SUCCESS) {
+            result = ma_sound_init_from_data_source(&sModAudioEngine, &audio->decoder, MA_SOUND_STREAM_FLAGS, NULL, &audio->sound);
+            if (result == MA_SUCCESS) {
+                audio->buffer = NULL;
+                audio->bufferSize = 0;
+                audio->isStream = true;
+                audio->loaded = true;
+                return audio;
+            }
+            ma_decoder_uninit(&audio->decoder);
+        }
+        LOG_INFO("could not stream audio file '%s' from disk (%d), loading it whole", filename, result);
+    }
+
     // load audio
     FILE *f = f_open_r(modFile->cachedPath);
     if (!f) {
@@ -326,6 +344,12 @@ void audio_stream_destroy(struct ModAudio* audio) {
     if (!audio_sanity_check(audio, true, "destroy")) { return; }
 
     ma_sound_uninit(&audio->sound);
+    ma_decoder_uninit(&audio->decoder);
+    if (audio->buffer) {
+        free(audio->buffer);
+        audio->buffer = NULL;
+        audio->bufferSize = 0;
+    }
     audio->loaded = false;
 }
 
@@ -604,6 +628,7 @@ void audio_custom_shutdown(void) {
                 audio_sample_destroy_copies(audio);
             }
             ma_sound_uninit(&audio->sound);
+            if (audio->isStream) { ma_decoder_uninit(&audio->decoder); }
         }
         dynamic_pool_free(sModAudioPool, audio);
         node = prev;
@@ -1,6 +1,7 @@
 #include "types.h"
 #include "object_constants.h"
 #include "object_fields.h"
+#include "game/object_behavior_index.h"
 #include "game/object_helpers.h"
 #include "game/interaction.h"
 #include "engine/math_util.h"
@@ -173,10 +174,9 @@ struct Object *obj_get_first_with_behavior_id(enum BehaviorId behaviorId) {
     u32 sanityDepth = 0;
     behavior = smlua_override_behavior(behavior);
     if (behavior) {
-        enum ObjectList objList = get_object_list_from_behavior(behavior);
-        for (struct Object *obj = obj_get_first(objList); obj != NULL; obj = obj_get_next_internal(obj, objList)) {
+        for (struct Object *obj = obj_behavior_index_first(behavior); obj != NULL; obj = obj_behavior_index_next(obj)) {
             if (++sanityDepth > 10000) { break; }
-            if (obj->behavior == behavior && obj->activeFlags != ACTIVE_FLAG_DEACTIVATED) {
+            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED) {
                 return obj;
             }
         }
@@ -190,10 +190,9 @@ struct Object *obj_get_first_with_behavior_id_and_field_s32(enum BehaviorId beha
     u32 sanityDepth = 0;
     behavior = smlua_override_behavior(behavior);
     if (behavior) {
-        enum ObjectList objList = get_object_list_from_behavior(behavior);
-        for (struct Object *obj = obj_get_first(objList); obj != NULL; obj = obj_get_next_internal(obj, objList)) {
+        for (struct Object *obj = obj_behavior_index_first(behavior); obj != NULL; obj = obj_behavior_index_next(obj)) {
             if (++sanityDepth > 10000) { break; }
-            if (obj->behavior == behavior && obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj->OBJECT_FIELD_S32(fieldIndex) == value) {
+            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj->OBJECT_FIELD_S32(fieldIndex) == value) {
                 return obj;
             }
         }
@@ -206,9 +205,8 @@ struct Object *obj_get_first_with_behavior_id_and_field_f32(enum BehaviorId beha
     const BehaviorScript* behavior = get_behavior_from_id(behaviorId);
     behavior = smlua_override_behavior(behavior);
     if (behavior) {
-        enum ObjectList objList = get_object_list_from_behavior(behavior);
-        for (struct Object *obj = obj_get_first(objList); obj != NULL; obj = obj_get_next_internal(obj, objList)) {
-            if (obj->behavior == behavior && obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj->OBJECT_FIELD_F32(fieldIndex) == value) {
+        for (struct Object *obj = obj_behavior_index_first(behavior); obj != NULL; obj = obj_behavior_index_next(obj)) {
+            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj->OBJECT_FIELD_F32(fieldIndex) == value) {
                 return obj;
             }
         }
@@ -223,9 +221,8 @@ struct Object *obj_get_nearest_object_with_behavior_id(struct Object *o, enum Be
     struct Object *closestObj = NULL;
 
     if (behavior) {
-        enum ObjectList objList = get_object_list_from_behavior(behavior);
-        for (struct Object *obj = obj_get_first(objList); obj != NULL; obj = obj_get_next_internal(obj, objList)) {
-            if (obj->behavior == behavior && obj->activeFlags != ACTIVE_FLAG_DEACTIVATED) {
+        for (struct Object *obj = obj_behavior_index_first(behavior); obj != NULL; obj = obj_behavior_index_next(obj)) {
+            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED) {
                 f32 objDist = dist_between_objects(o, obj);
                 if (objDist < minDist) {
                     closestObj = obj;
@@ -243,9 +240,8 @@ s32 obj_count_objects_with_behavior_id(enum BehaviorId behaviorId) {
     s32 count = 0;
 
     if (behavior) {
-        enum ObjectList objList = get_object_list_from_behavior(behavior);
-        for (struct Object *obj = obj_get_first(objList); obj != NULL; obj = obj_get_next_internal(obj, objList)) {
-            if (obj->behavior == behavior && obj->activeFlags != ACTIVE_FLAG_DEACTIVATED) { count++; }
+        for (struct Object *obj = obj_behavior_index_first(behavior); obj != NULL; obj = obj_behavior_index_next(obj)) {
+            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED) { count++; }
         }
     }
 
@@ -254,9 +250,8 @@ s32 obj_count_objects_with_behavior_id(enum BehaviorId behaviorId) {
 
 struct Object *obj_get_next_with_same_behavior_id(struct Object *o) {
     if (o) {
-        enum ObjectList objList = get_object_list_from_behavior(o->behavior);
-        for (struct Object *obj = obj_get_next_internal(o, objList); obj != NULL; obj = obj_get_next_internal(obj, objList)) {
-            if (obj->behavior == o->behavior && obj->activeFlags != ACTIVE_FLAG_DEACTIVATED) {
+        for (struct Object *obj = obj_behavior_index_next(o); obj != NULL; obj = obj_behavior_index_next(obj)) {
+            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED) {
                 return obj;
             }
         }
@@ -267,9 +262,8 @@ struct Object *obj_get_next_with_same_behavior_id(struct Object *o) {
 struct Object *obj_get_next_with_same_behavior_id_and_field_s32(struct Object *o, s32 fieldIndex, s32 value) {
     if (fieldIndex < 0 || fieldIndex >= OBJECT_NUM_FIELDS) { return NULL; }
     if (o) {
-        enum ObjectList objList = get_object_list_from_behavior(o->behavior);
-        for (struct Object *obj = obj_get_next_internal(o, objList); obj != NULL; obj = obj_get_next_internal(obj, objList)) {
-            if (obj->behavior == o->behavior && obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj->OBJECT_FIELD_S32(fieldIndex) == value) {
+        for (struct Object *obj = obj_behavior_index_next(o); obj != NULL; obj = obj_behavior_index_next(obj)) {
+            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj->OBJECT_FIELD_S32(fieldIndex) == value) {
                 return obj;
             }
         }
@@ -280,9 +274,8 @@ struct Object *obj_get_next_with_same_behavior_id_and_field_s32(struct Object *o
 struct Object *obj_get_next_with_same_behavior_id_and_field_f32(struct Object *o, s32 fieldIndex, f32 value) {
     if (fieldIndex < 0 || fieldIndex >= OBJECT_NUM_FIELDS) { return NULL; }
     if (o) {
-        enum ObjectList objList = get_object_list_from_behavior(o->behavior);
-        for (struct Object *obj = obj_get_next_internal(o, objList); obj != NULL; obj = obj_get_next_internal(obj, objList)) {
-            if (obj->behavior == o->behavior && obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj->OBJECT_FIELD_F32(fieldIndex) == value) {
+        for (struct Object *obj = obj_behavior_index_next(o); obj != NULL; obj = obj_behavior_index_next(obj)) {
+            if (obj->activeFlags != ACTIVE_FLAG_DEACTIVATED && obj->OBJECT_FIELD_F32(fieldIndex) == value) {
                 return obj;
             }
         }
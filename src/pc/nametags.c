@@ -33,18 +33,11 @@ void name_without_hex(char* input) {
 }
 
 void djui_hud_print_outlined_text_interpolated(const char* text, f32 prevX, f32 prevY, f32 prevScale, f32 x, f32 y, f32 scale, u8 r, u8 g, u8 b, u8 a, f32 outlineDarkness) {
-    f32 offset = 1 * (scale * 2);
-    f32 prevOffset = 1 * (prevScale * 2);
-
-    // render outline
-    djui_hud_set_color(r * outlineDarkness, g * outlineDarkness, b * outlineDarkness, a);
-    djui_hud_print_text_interpolated(text, prevX - prevOffset, prevY,              prevScale, x - offset, y,          scale);
-    djui_hud_print_text_interpolated(text, prevX + prevOffset, prevY,              prevScale, x + offset, y,          scale);
-    djui_hud_print_text_interpolated(text, prevX,              prevY - prevOffset, prevScale, x,          y - offset, scale);
-    djui_hud_print_text_interpolated(text, prevX,              prevY + prevOffset, prevScale, x,          y + offset, scale);
-    // render text
+    // the outline is drawn by the same print as the text
+    djui_hud_set_text_outline(r * outlineDarkness, g * outlineDarkness, b * outlineDarkness, a, 2);
     djui_hud_set_color(r, g, b, a);
     djui_hud_print_text_interpolated(text, prevX, prevY, prevScale, x, y, scale);
+    djui_hud_reset_text_outline();
     djui_hud_set_color(255, 255, 255, 255);
 }
 
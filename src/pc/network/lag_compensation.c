@@ -1,36 +1,107 @@
 #include "types.h"
+#include "object_fields.h"
 #include "network_player.h"
 #include "lag_compensation.h"
 #include "pc/debuglog.h"
+#include "engine/math_util.h"
 #include "game/object_helpers.h"
 #include "behavior_table.h"
 #include "model_ids.h"
 
-struct StateHistory {
+// Only what interactions between players read is stored every tick, for every player.
+// A full MarioState is rebuilt from the live state when a past state is asked for.
+struct StateSnapshot {
+    bool valid;
+
+    // MarioState
+    Vec3f pos;
+    Vec3f vel;
+    Vec3s faceAngle;
+    f32 forwardVel;
+    u32 action;
+    u32 actionArg;
+    u16 actionTimer;
+    u16 actionState;
+    u32 flags;
+    s16 invincTimer;
+    u8 hurtCounter;
+    s8 knockbackTimer;
+
+    // Mario's object
+    Vec3f objPos;
+    s32 objFaceAngleYaw;
+    s32 objMoveAngleYaw;
+    s32 objIntangibleTimer;
+    f32 hitboxRadius;
+    f32 hitboxHeight;
+    f32 hitboxDownOffset;
+    s16 numCollidedObjs;
+
+    // MarioBodyState
+    Vec3f torsoPos;
+    bool mirrorMario;
+};
+
+struct StateView {
     struct MarioState m;
     struct Object marioObj;
     struct MarioBodyState bodyState;
 };
 
-static struct StateHistory sLocalStateHistory[MAX_LOCAL_STATE_HISTORY] = { 0 };
+static struct StateSnapshot sStateHistory[MAX_PLAYERS][MAX_LOCAL_STATE_HISTORY] = { 0 };
 static bool sLocalStateHistoryReady = false;
 static u32 sLocalStateHistoryIndex = 0;
 
+// Views are only built when asked for, into one scratch view per player.
+// A view stays valid until a past state of the same player is asked for again.
+static struct StateView sStateViews[MAX_PLAYERS] = { 0 };
+
 void lag_compensation_clear(void) {
     sLocalStateHistoryReady = false;
     sLocalStateHistoryIndex = 0;
 }
 
+static void lag_compensation_store_player(struct MarioState* m, struct StateSnapshot* s) {
+    struct Object* o = m->marioObj;
+    struct MarioBodyState* bodyState = m->marioBodyState;
+    s->valid = (o != NULL && bodyState != NULL);
+    if (!s->valid) { return; }
+
+    vec3f_copy(s->pos, m->pos);
+    vec3f_copy(s->vel, m->vel);
+    vec3s_copy(s->faceAngle, m->faceAngle);
+    s->forwardVel = m->forwardVel;
+    s->action = m->action;
+    s->actionArg = m->actionArg;
+    s->actionTimer = m->actionTimer;
+    s->actionState = m->actionState;
+    s->flags = m->flags;
+    s->invincTimer = m->invincTimer;
+    s->hurtCounter = m->hurtCounter;
+    s->knockbackTimer = m->knockbackTimer;
+
+    s->objPos[0] = o->oPosX;
+    s->objPos[1] = o->oPosY;
+    s->objPos[2] = o->oPosZ;
+    s->objFaceAngleYaw = o->oFaceAngleYaw;
+    s->objMoveAngleYaw = o->oMoveAngleYaw;
+    s->objIntangibleTimer = o->oIntangibleTimer;
+    s->hitboxRadius = o->hitboxRadius;
+    s->hitboxHeight = o->hitboxHeight;
+    s->hitboxDownOffset = o->hitboxDownOffset;
+    s->numCollidedObjs = o->numCollidedObjs;
+
+    vec3f_copy(s->torsoPos, bodyState->torsoPos);
+    s->mirrorMario = bodyState->mirrorMario;
+}
+
 void lag_compensation_store(void) {
     if (!gMarioStates[0].marioBodyState) { return; }
     if (!gMarioStates[0].marioObj) { return; }
 
-    struct StateHistory* sh = &sLocalStateHistory[sLocalStateHistoryIndex];
-    memcpy(&sh->m, &gMarioStates[0], sizeof(struct MarioState));
-    memcpy(&sh->marioObj, gMarioStates[0].marioObj, sizeof(struct Object));
-    memcpy(&sh->bodyState, gMarioStates[0].marioBodyState, sizeof(struct MarioBodyState));
-    sh->m.marioObj = &sh->marioObj;
-    sh->m.marioBodyState = &sh->bodyState;
+    for (s32 i = 0; i < MAX_PLAYERS; i++) {
+        lag_compensation_store_player(&gMarioStates[i], &sStateHistory[i][sLocalStateHistoryIndex]);
+    }
 
     if (sLocalStateHistoryIndex + 1 >= MAX_LOCAL_STATE_HISTORY) {
         sLocalStateHistoryReady = true;
@@ -38,23 +109,73 @@ void lag_compensation_store(void) {
     sLocalStateHistoryIndex = (sLocalStateHistoryIndex + 1) % MAX_LOCAL_STATE_HISTORY;
 }
 
+struct MarioState* lag_compensation_get_player_state(u8 playerIndex, u32 ticksAgo) {
+    if (playerIndex >= MAX_PLAYERS) { return NULL; }
+    struct MarioState* live = &gMarioStates[playerIndex];
+    if (!sLocalStateHistoryReady || ticksAgo == 0) { return live; }
+    if (!live->marioObj || !live->marioBodyState) { return live; }
+
+    if (ticksAgo > (MAX_LOCAL_STATE_HISTORY-1)) {
+        ticksAgo = (MAX_LOCAL_STATE_HISTORY-1);
+    }
+
+    s32 index = (s32)sLocalStateHistoryIndex - (s32)ticksAgo;
+    while (index < 0) { index += MAX_LOCAL_STATE_HISTORY; }
+    index = index % MAX_LOCAL_STATE_HISTORY;
+
+    struct StateSnapshot* s = &sStateHistory[playerIndex][index];
+    if (!s->valid) { return live; }
+
+    // start from the live state, then rewind what interactions look at
+    struct StateView* view = &sStateViews[playerIndex];
+    memcpy(&view->m, live, sizeof(struct MarioState));
+    memcpy(&view->marioObj, live->marioObj, sizeof(struct Object));
+    memcpy(&view->bodyState, live->marioBodyState, sizeof(struct MarioBodyState));
+    view->m.marioObj = &view->marioObj;
+    view->m.marioBodyState = &view->bodyState;
+
+    struct MarioState* m = &view->m;
+    vec3f_copy(m->pos, s->pos);
+    vec3f_copy(m->vel, s->vel);
+    vec3s_copy(m->faceAngle, s->faceAngle);
+    m->forwardVel = s->forwardVel;
+    m->action = s->action;
+    m->actionArg = s->actionArg;
+    m->actionTimer = s->actionTimer;
+    m->actionState = s->actionState;
+    m->flags = s->flags;
+    m->invincTimer = s->invincTimer;
+    m->hurtCounter = s->hurtCounter;
+    m->knockbackTimer = s->knockbackTimer;
+
+    struct Object* o = &view->marioObj;
+    o->oPosX = s->objPos[0];
+    o->oPosY = s->objPos[1];
+    o->oPosZ = s->objPos[2];
+    o->oFaceAngleYaw = s->objFaceAngleYaw;
+    o->oMoveAngleYaw = s->objMoveAngleYaw;
+    o->oIntangibleTimer = s->objIntangibleTimer;
+    o->hitboxRadius = s->hitboxRadius;
+    o->hitboxHeight = s->hitboxHeight;
+    o->hitboxDownOffset = s->hitboxDownOffset;
+    o->numCollidedObjs = s->numCollidedObjs;
+
+    vec3f_copy(view->bodyState.torsoPos, s->torsoPos);
+    view->bodyState.mirrorMario = s->mirrorMario;
+
+    return m;
+}
+
 struct MarioState* lag_compensation_get_local_state(struct NetworkPlayer* otherNp) {
     if (!otherNp) { return &gMarioStates[0]; }
     if (gNetworkType == NT_NONE) { return &gMarioStates[0]; }
     if (!sLocalStateHistoryReady) { return &gMarioStates[0]; }
 
     s32 pingToTicks = (otherNp->ping / 1000.0f) * 30;
-    if (pingToTicks > (MAX_LOCAL_STATE_HISTORY-1)) {
-        pingToTicks = (MAX_LOCAL_STATE_HISTORY-1);
-    }
     //LOG_INFO("Ping: %s :: %u :: %d", otherNp->name, otherNp->ping, pingToTicks);
-    if (pingToTicks == 0) { return &gMarioStates[0]; }
-
-    s32 index = (s32)sLocalStateHistoryIndex - pingToTicks;
-    while (index < 0) { index += MAX_LOCAL_STATE_HISTORY; }
-    index = index % MAX_LOCAL_STATE_HISTORY;
+    if (pingToTicks <= 0) { return &gMarioStates[0]; }
 
-    return &sLocalStateHistory[index].m;
+    return lag_compensation_get_player_state(0, pingToTicks);
 }
 
 bool lag_compensation_get_local_state_ready(void) {
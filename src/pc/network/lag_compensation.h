@@ -6,7 +6,11 @@
 void lag_compensation_clear(void);
 /* |description|Stores the local Mario's current state in lag compensation history|descriptionEnd| */
 void lag_compensation_store(void);
-/* |description|Gets the local Mario's state stored in lag compensation history|descriptionEnd| */
+// Past states are built into a scratch view per player that is overwritten by the next call for
+// that player. Only the position, velocity, angles, action, timers, flags, hitbox and torso
+// position are historical, every other field is copied from the player's live state.
+struct MarioState* lag_compensation_get_player_state(u8 playerIndex, u32 ticksAgo);
+/* |description|Gets the local Mario's state stored in lag compensation history. Only the position, velocity, angles, action, timers, flags, hitbox and torso position are historical, every other field comes from the live state|descriptionEnd| */
 struct MarioState* lag_compensation_get_local_state(struct NetworkPlayer* otherNp);
 /* |description|Checks if lag compensation history is ready|descriptionEnd| */
 bool lag_compensation_get_local_state_ready(void);
@@ -296,6 +296,13 @@ void network_send_to(u8 localIndex, struct Packet* p) {
 
     p->localIndex = localIndex;
 
+    // collect the packet into the current bundle instead of sending it on its own
+    if (packet_bundle_add(localIndex, p)) {
+        p->sent = true;
+        return;
+    }
+    packet_bundle_flush();
+
     // set ordered data (MUST BE IMMEDITAELY BEFORE network_remember_reliable())
     if (p->orderedGroupId != 0 && !p->sent) {
         packet_set_ordered_data(p);
@@ -138,24 +138,24 @@ void packet_process(struct Packet* p) {
 
         case PACKET_LUA_CUSTOM:              network_receive_lua_custom(p);              break;
 
+        case PACKET_BUNDLE:                  network_receive_bundle(p);                  break;
+
         // custom
         case PACKET_CUSTOM:                  network_receive_custom(p);                  break;
         default: LOG_ERROR("received unknown packet: %d", p->buffer[0]);
     }
 }
 
-void packet_receive(struct Packet* p) {
+// Returns whether a received packet should be dropped
+static bool packet_receive_refused(struct Packet* p) {
     u8 packetType = (u8)p->buffer[0];
 
-    // send an ACK if requested
-    network_send_ack(p);
-
     // refuse packets from banned players
     if (gNetworkType == NT_SERVER) {
         if (ban_list_contains(gNetworkSystem->get_id_str(p->localIndex))) {
             LOG_INFO("kicking banned player");
             network_send_kick(0, EKT_BANNED);
-            return;
+            return true;
         }
     }
 
@@ -165,7 +165,7 @@ void packet_receive(struct Packet* p) {
         if (gNetworkPlayerServer != NULL) { fromServer = fromServer || p->localIndex == gNetworkPlayerServer->localIndex; }
         if (fromServer && !gNetworkSystem->match_addr(gNetworkServerAddr, p->addr)) {
             LOG_INFO("refusing packet from unknown server");
-            return;
+            return true;
         }
     }
 
@@ -173,14 +173,14 @@ void packet_receive(struct Packet* p) {
     if (gNetworkType == NT_SERVER && p->localIndex == UNKNOWN_LOCAL_INDEX && !network_allow_unknown_local_index(packetType)) {
         if (gNetworkStartupTimer > 0) {
             LOG_INFO("refusing packet from unknown player on startup, packetType: %d", packetType);
-            return;
+            return true;
         }
         if (packetType != PACKET_PLAYER) {
             LOG_INFO("closing connection for packetType: %d", packetType);
             network_send_kick(0, EKT_CLOSE_CONNECTION);
         }
         LOG_INFO("refusing packet from unknown player, packetType: %d", packetType);
-        return;
+        return true;
     }
 
     // check if we've already seen this packet
@@ -190,7 +190,7 @@ void packet_receive(struct Packet* p) {
         for (s32 i = 0; i < MAX_RX_SEQ_IDS; i++) {
             if (np->rxSeqIds[i] == p->seqId && np->rxPacketHash[i] == packetHash) {
                 LOG_INFO("received duplicate packet %u", packetType);
-                return;
+                return true;
             }
         }
         // remember seq id
@@ -199,6 +199,12 @@ void packet_receive(struct Packet* p) {
         np->onRxSeqId++;
         //if (np->onRxSeqId >= MAX_RX_SEQ_IDS) { np->onRxSeqId = 0; }
     }
+    return false;
+}
+
+// Relays, orders or processes a packet that wasn't refused, then rebroadcasts it if requested
+static void packet_receive_accepted(struct Packet* p, bool ordered) {
+    u8 packetType = (u8)p->buffer[0];
 
     // parse the packet without processing the rest
     if (packet_initial_read(p)) {
@@ -207,7 +213,7 @@ void packet_receive(struct Packet* p) {
             struct Packet p2 = { 0 };
             packet_duplicate(p, &p2);
             network_send_to(p->destGlobalId, &p2);
-        } else if (p->orderedGroupId != 0) {
+        } else if (p->orderedGroupId != 0 && ordered) {
             // add the packet to the ordered bucket (may process immediately if it's in order)
             packet_ordered_add(p);
         } else {
@@ -232,6 +238,23 @@ void packet_receive(struct Packet* p) {
     }
 }
 
+void packet_receive(struct Packet* p) {
+    // send an ACK if requested
+    network_send_ack(p);
+
+    if (packet_receive_refused(p)) { return; }
+    packet_receive_accepted(p, true);
+}
+
+void packet_receive_bundled(struct Packet* p) {
+    // the bundle was acknowledged and ordered as a whole, its packets are only checked
+    memcpy(&p->seqId, &p->buffer[1], sizeof(u16));
+    p->reliable = (p->seqId != 0);
+
+    if (packet_receive_refused(p)) { return; }
+    packet_receive_accepted(p, false);
+}
+
 bool packet_spoofed(struct Packet* p, u8 globalIndex) {
     if (gNetworkSystem->requireServerBroadcast) { return false; }
     if (p->localIndex == UNKNOWN_LOCAL_INDEX) { return false; }
@@ -77,6 +77,8 @@ enum PacketType {
     PACKET_COMMAND,
     PACKET_MODERATOR,
 
+    PACKET_BUNDLE,
+
     ///
     PACKET_CUSTOM = 255,
 };
@@ -156,6 +158,7 @@ void packet_compress(struct Packet* p, u8** compBuffer, u32* compSize);
 bool packet_decompress(struct Packet* p, u8* compBuffer, u32 compSize);
 void packet_process(struct Packet* p);
 void packet_receive(struct Packet* packet);
+void packet_receive_bundled(struct Packet* packet);
 bool packet_spoofed(struct Packet* p, u8 globalIndex);
 
 // packet_read_write.c
@@ -381,4 +384,11 @@ void network_receive_request_failed(struct Packet* p);
 void network_send_lua_custom(bool broadcast);
 void network_receive_lua_custom(struct Packet* p);
 
+// packet_bundle.c
+void packet_bundle_begin(u8 localIndex);
+void packet_bundle_end(void);
+bool packet_bundle_add(u8 localIndex, struct Packet* p);
+void packet_bundle_flush(void);
+void network_receive_bundle(struct Packet* p);
+
 #endif
@@ -37,6 +37,7 @@ void network_send_area(struct NetworkPlayer* toNp) {
     bool levelControlTimerVisible = (gHudDisplay.flags & HUD_DISPLAY_FLAG_TIMER) ? 1 : 0;
 
     packet_ordered_begin();
+    packet_bundle_begin(toNp->localIndex);
     {
         struct Packet p = { 0 };
         packet_init(&p, PACKET_AREA, true, PLMT_NONE);
@@ -123,6 +124,7 @@ void network_send_area(struct NetworkPlayer* toNp) {
         // send sync valid
         network_send_sync_valid(toNp, gCurrCourseNum, gCurrActStarNum, gCurrLevelNum, gCurrAreaIndex);
     }
+    packet_bundle_end();
     packet_ordered_end();
 
     LOG_INFO("tx area");
@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include "../network.h"
+//#define DISABLE_MODULE_LOG 1
+#include "pc/debuglog.h"
+
+// Packets sent to the same player between packet_bundle_begin() and packet_bundle_end()
+// are packed into as few PACKET_BUNDLE packets as possible, so that a level/area sync is
+// a handful of reliable packets (compressed as a whole) instead of one per object.
+// The receiver processes the inner packets in order, in one go.
+// Packets that aren't bundled flush the pending bundle first, so packets are still sent in order.
+
+#define PACKET_BUNDLE_VERSION 1
+
+static struct Packet sBundle = { 0 };
+static bool sBundleOpen = false;
+static u16 sBundleCount = 0;
+static u16 sBundleCountOffset = 0;
+static u8 sBundleLocalIndex = 0;
+static u32 sBundleDepth = 0;
+
+void packet_bundle_flush(void) {
+    if (!sBundleOpen) { return; }
+    sBundleOpen = false;
+
+    memcpy(&sBundle.buffer[sBundleCountOffset], &sBundleCount, sizeof(u16));
+    network_send_to(sBundleLocalIndex, &sBundle);
+    LOG_INFO("tx bundle to %d (count %d, size %d)", sBundleLocalIndex, sBundleCount, sBundle.dataLength);
+}
+
+void packet_bundle_begin(u8 localIndex) {
+    if (sBundleDepth++ > 0) { return; }
+    sBundleLocalIndex = localIndex;
+    sBundleOpen = false;
+}
+
+void packet_bundle_end(void) {
+    if (sBundleDepth == 0) { return; }
+    if (--sBundleDepth > 0) { return; }
+    packet_bundle_flush();
+}
+
+bool packet_bundle_add(u8 localIndex, struct Packet* p) {
+    if (sBundleDepth == 0 || localIndex != sBundleLocalIndex) { return false; }
+    if (!p->reliable || p->packetType == PACKET_BUNDLE) { return false; }
+
+    // the hash is appended after the data when the bundle is sent
+    const u16 capacity = PACKET_LENGTH - sizeof(u32) - 1;
+    u16 entrySize = sizeof(u16) + p->dataLength;
+
+    // make room for the packet
+    if (sBundleOpen && sBundle.cursor + entrySize > capacity) {
+        packet_bundle_flush();
+    }
+
+    if (!sBundleOpen) {
+        packet_init(&sBundle, PACKET_BUNDLE, true, PLMT_NONE);
+        u8 version = PACKET_BUNDLE_VERSION;
+        packet_write(&sBundle, &version, sizeof(u8));
+        sBundleCount = 0;
+        sBundleCountOffset = sBundle.cursor;
+        packet_write(&sBundle, &sBundleCount, sizeof(u16));
+
+        // packets that don't fit in an empty bundle are sent on their own
+        if (sBundle.cursor + entrySize > capacity) {
+            return false;
+        }
+        sBundleOpen = true;
+    }
+
+    packet_write(&sBundle, &p->dataLength, sizeof(u16));
+    packet_write(&sBundle, p->buffer, p->dataLength);
+    sBundleCount++;
+    return true;
+}
+
+void network_receive_bundle(struct Packet* p) {
+    u8 version = 0;
+    packet_read(p, &version, sizeof(u8));
+    if (version != PACKET_BUNDLE_VERSION) {
+        LOG_ERROR("rx bundle: unknown version %d", version);
+        return;
+    }
+
+    u16 count = 0;
+    packet_read(p, &count, sizeof(u16));
+
+    for (u16 i = 0; i < count; i++) {
+        u16 length = 0;
+        packet_read(p, &length, sizeof(u16));
+        if (p->error || length < 3 || length > p->dataLength - p->cursor) {
+            LOG_ERROR("rx bundle: invalid packet length %d", length);
+            return;
+        }
+
+        struct Packet inner = {
+            .localIndex = p->localIndex,
+            .cursor = 3,
+            .addr = p->addr,
+            .dataLength = length,
+        };
+        memcpy(inner.buffer, &p->buffer[p->cursor], length);
+        p->cursor += length;
+
+        if (inner.buffer[0] == PACKET_BUNDLE || inner.buffer[0] == PACKET_ACK) {
+            LOG_ERROR("rx bundle: refusing packet type %d", inner.buffer[0]);
+            continue;
+        }
+
+        // inner packets go through the same checks, relays and rebroadcasts as standalone ones
+        packet_receive_bundled(&inner);
+    }
+
+    LOG_INFO("rx bundle (count %d)", count);
+}
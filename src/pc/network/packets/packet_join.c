@@ -10,6 +10,7 @@
 #include "game/level_update.h"
 #include "game/hardcoded.h"
 #include "pc/fs/fs.h"
+#include "pc/eeprom.h"
 #include "PR/os_eeprom.h"
 #include "pc/network/version.h"
 #include "pc/djui/djui.h"
@@ -100,11 +101,8 @@ void network_send_join(struct Packet* joinRequestPacket) {
     // do connection event
     network_player_connected(NPT_CLIENT, globalIndex, sJoinRequestPlayerModel, &sJoinRequestPlayerPalette, sJoinRequestPlayerName, sJoinRequestDiscordId);
 
-    fs_file_t* fp = fs_open(SAVE_FILENAME);
-    if (fp != NULL) {
-        fs_read(fp, eeprom, 512);
-        fs_close(fp);
-    }
+    // the save may not have been flushed to disk yet
+    eeprom_read(0, eeprom, 512);
 
     char version[MAX_VERSION_LENGTH] = { 0 };
     snprintf(version, MAX_VERSION_LENGTH, "%s", get_version());
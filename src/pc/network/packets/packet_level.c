@@ -17,6 +17,7 @@ void network_send_level(struct NetworkPlayer* toNp, bool sendArea) {
     extern s16 gCurrCourseNum, gCurrActStarNum, gCurrLevelNum;
 
     packet_ordered_begin();
+    packet_bundle_begin(toNp->localIndex);
     {
         struct Packet p = { 0 };
         packet_init(&p, PACKET_LEVEL, true, PLMT_NONE);
@@ -48,6 +49,7 @@ void network_send_level(struct NetworkPlayer* toNp, bool sendArea) {
             network_send_sync_valid(toNp, gCurrCourseNum, gCurrActStarNum, gCurrLevelNum, -1);
         }
     }
+    packet_bundle_end();
     packet_ordered_end();
 
     LOG_INFO("tx level");
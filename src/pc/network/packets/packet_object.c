@@ -6,6 +6,7 @@
 #include "behavior_data.h"
 #include "behavior_table.h"
 #include "game/memory.h"
+#include "game/object_behavior_index.h"
 #include "game/object_helpers.h"
 #include "game/obj_behaviors.h"
 #include "game/object_list_processor.h"
@@ -76,6 +77,7 @@ static bool allowable_behavior_change(struct SyncObject* so, BehaviorScript* beh
 
     so->behavior = behavior;
     so->o->behavior = behavior;
+    obj_behavior_index_update(so->o);
     return true;
 }
 
@@ -27,6 +27,7 @@
 #include "cliopts.h"
 #include "configfile.h"
 #include "thread.h"
+#include "eeprom.h"
 #include "controller/controller_api.h"
 #include "controller/controller_keyboard.h"
 #include "controller/controller_mouse.h"
@@ -35,6 +36,7 @@
 #include "game/display.h" // for gGlobalTimer
 #include "game/game_init.h"
 #include "game/main.h"
+#include "game/object_list_processor.h"
 #include "game/rumble_init.h"
 
 #include "pc/lua/utils/smlua_audio_utils.h"
@@ -220,7 +222,11 @@ void produce_interpolation_frames_and_delay(void) {
         gRenderingDelta = delta;
 
         gfx_start_frame();
-        if (!gSkipInterpolationTitleScreen) { patch_interpolations(delta); }
+        if (!gSkipInterpolationTitleScreen) {
+            CTX_BEGIN(CTX_INTERP);
+            patch_interpolations(delta);
+            CTX_END(CTX_INTERP);
+        }
         send_display_list(gGfxSPTask);
         gfx_end_frame();
 
@@ -280,9 +286,12 @@ inline static void buffer_audio(void) {
     }
 }
 
+// Cleared by audio_shutdown() to make the audio thread exit its loop.
+static bool sAudioThreadRunning = false;
+
 void *audio_thread(UNUSED void *arg) {
     // As long as we have an audio api and that we're threaded, Loop.
-    while (audio_api) {
+    while (__atomic_load_n(&sAudioThreadRunning, __ATOMIC_ACQUIRE)) {
         f64 curTime = clock_elapsed_f64();
 
         // Buffer the audio.
@@ -316,6 +325,9 @@ void produce_one_frame(void) {
 
     CTX_EXTENT(CTX_SMLUA, smlua_update);
 
+    // Write the saves made during this frame to disk
+    eeprom_flush(false);
+
     // If we aren't threaded
     if (gAudioThread.state == INVALID) {
         CTX_EXTENT(CTX_AUDIO, buffer_audio);
@@ -357,6 +369,12 @@ void produce_one_dummy_frame(void (*callback)(), u8 clearColorR, u8 clearColorG,
 }
 
 void audio_shutdown(void) {
+    // Stop mixing before the audio api goes away.
+    if (gAudioThread.state == RUNNING) {
+        __atomic_store_n(&sAudioThreadRunning, false, __ATOMIC_RELEASE);
+        join_thread(&gAudioThread);
+    }
+
     audio_custom_shutdown();
     if (audio_api) {
         if (audio_api->shutdown) audio_api->shutdown();
@@ -366,6 +384,7 @@ void audio_shutdown(void) {
 
 void game_deinit(void) {
     if (gGameInited) { configfile_save(configfile_name()); }
+    eeprom_flush(true);
     controller_shutdown();
     audio_custom_shutdown();
     audio_shutdown();
@@ -374,6 +393,7 @@ void game_deinit(void) {
     smlua_shutdown();
     smlua_audio_custom_deinit();
     mods_shutdown();
+    dynos_pack_shutdown();
     djui_shutdown();
     gfx_shutdown();
     gGameInited = false;
@@ -505,8 +525,16 @@ int main(int argc, char *argv[]) {
 #endif
     if (!audio_api) audio_api = &audio_null;
 
-    // Initialize the audio thread if possible.
-    // init_thread_handle(&gAudioThread, audio_thread, NULL, NULL, 0);
+    // Initialize the audio thread if enabled, otherwise audio is buffered at the end of every game frame.
+    // Sound requests reach it through a lock-free queue, everything else goes through the audio mutex.
+    // The mutex is recursive since the locked audio entry points call into each other.
+    if (configAudioThread) {
+        sAudioThreadRunning = true;
+        if (init_recursive_mutex(&gAudioThread) != 0 || init_thread(&gAudioThread, audio_thread, NULL, NULL, 0) != 0) {
+            sAudioThreadRunning = false;
+            gAudioThread.state = INVALID;
+        }
+    }
 
 #ifdef LOADING_SCREEN_SUPPORTED
     loading_screen_reset();
@@ -550,6 +578,12 @@ int main(int argc, char *argv[]) {
     // main loop
     while (true) {
         debug_context_reset();
+
+        // collision query counters are per frame, the context profiler shows them after it
+        gNumCalls.floor = 0;
+        gNumCalls.ceil = 0;
+        gNumCalls.wall = 0;
+
         CTX_BEGIN(CTX_TOTAL);
         WAPI.main_loop(produce_one_frame);
 #ifdef DISCORD_SDK
@@ -165,6 +165,45 @@ static void rom_asset_load(struct RomAsset* asset) {
     }
 }
 
+static bool rom_asset_before(struct RomAsset* a, struct RomAsset* b) {
+    if (a->physicalAddress != b->physicalAddress) { return a->physicalAddress < b->physicalAddress; }
+    return a->physicalSize <= b->physicalSize;
+}
+
+// Stable merge sort by physical range, so that every segment is read and decompressed once
+static struct RomAsset* rom_assets_sort(struct RomAsset* list) {
+    if (list == NULL || list->next == NULL) { return list; }
+
+    // split the list in half
+    struct RomAsset* slow = list;
+    struct RomAsset* fast = list->next;
+    while (fast != NULL && fast->next != NULL) {
+        slow = slow->next;
+        fast = fast->next->next;
+    }
+    struct RomAsset* second = slow->next;
+    slow->next = NULL;
+
+    struct RomAsset* a = rom_assets_sort(list);
+    struct RomAsset* b = rom_assets_sort(second);
+
+    // merge them back, preferring the first half on ties
+    struct RomAsset head = { 0 };
+    struct RomAsset* tail = &head;
+    while (a != NULL && b != NULL) {
+        if (rom_asset_before(a, b)) {
+            tail->next = a;
+            a = a->next;
+        } else {
+            tail->next = b;
+            b = b->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = (a != NULL) ? a : b;
+    return head.next;
+}
+
 void rom_assets_load(void) {
     LOG_INFO("loading asset");
 
@@ -172,6 +211,8 @@ void rom_assets_load(void) {
 
     sRomFile = fopen(gRomFilename, "rb");
 
+    sRomAssets = rom_assets_sort(sRomAssets);
+
     while (sRomAssets) {
         rom_asset_load(sRomAssets);
 
@@ -111,6 +111,26 @@ int init_mutex(struct ThreadHandle *handle) {
     return ret;
 }
 
+// Same as init_mutex, but the owning thread may lock the mutex again while holding it.
+int init_recursive_mutex(struct ThreadHandle *handle) {
+    assert(handle != NULL);
+
+    pthread_mutexattr_t mtattr;
+
+    int err = pthread_mutexattr_init(&mtattr);
+    assert(err == 0);
+
+    err = pthread_mutexattr_settype(&mtattr, PTHREAD_MUTEX_RECURSIVE);
+    assert(err == 0);
+
+    int ret = pthread_mutex_init(&handle->mutex, &mtattr);
+
+    err = pthread_mutexattr_destroy(&mtattr);
+    assert(err == 0);
+
+    return ret;
+}
+
 int destroy_mutex(struct ThreadHandle *handle) {
     assert(handle != NULL);
 
@@ -37,6 +37,7 @@ int stop_thread(struct ThreadHandle *handle);
 
 //// Mutex
 int init_mutex(struct ThreadHandle *handle);
+int init_recursive_mutex(struct ThreadHandle *handle);
 int destroy_mutex(struct ThreadHandle *handle);
 int lock_mutex(struct ThreadHandle *handle);
 int trylock_mutex(struct ThreadHandle *handle);
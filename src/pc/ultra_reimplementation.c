@@ -4,6 +4,7 @@
 #include "macros.h"
 #include "platform.h"
 #include "fs/fs.h"
+#include "eeprom.h"
 
 u8* gOverrideEeprom = NULL;
 
@@ -130,20 +131,7 @@ s32 osEepromLongRead(UNUSED OSMesgQueue *mq, u8 address, u8 *buffer, int nbytes)
         return 0;
     }
 
-    u8 content[512];
-    s32 ret = -1;
-
-    fs_file_t *fp = fs_open(SAVE_FILENAME);
-    if (fp == NULL) {
-        return -1;
-    }
-    if (fs_read(fp, content, 512) == 512) {
-        memcpy(buffer, content + address * 8, nbytes);
-        ret = 0;
-    }
-    fs_close(fp);
-
-    return ret;
+    return eeprom_read(address, buffer, nbytes);
 }
 
 s32 osEepromLongWrite(UNUSED OSMesgQueue *mq, u8 address, u8 *buffer, int nbytes) {
@@ -152,18 +140,6 @@ s32 osEepromLongWrite(UNUSED OSMesgQueue *mq, u8 address, u8 *buffer, int nbytes
         return 0;
     }
 
-    u8 content[512] = { 0 };
-    if (address != 0 || nbytes != 512) {
-        osEepromLongRead(mq, 0, content, 512);
-    }
-    memcpy(content + address * 8, buffer, nbytes);
-
-    FILE *fp = fopen(fs_get_write_path(SAVE_FILENAME), "wb");
-    if (fp == NULL) {
-        return -1;
-    }
-    s32 ret = fwrite(content, 1, 512, fp) == 512 ? 0 : -1;
-    fclose(fp);
-
-    return ret;
+    // written to disk at the end of the frame
+    return eeprom_write(address, buffer, nbytes);
 }